@@ -87,4 +87,42 @@ bool DictionaryContainer<Data>::RemoveSome(const TraversableContainer<Data> &box
 
 /* ************************************************************************** */
 
+template <typename Data>
+const Data* OrderedDictionaryContainer<Data>::TryMin()
+  const noexcept {
+    if (this->Size() == 0)
+                return nullptr;
+    return &Select(0);
+}
+
+template <typename Data>
+const Data* OrderedDictionaryContainer<Data>::TryMax()
+  const noexcept {
+    if (this->Size() == 0)
+                return nullptr;
+    return &Select(this->Size() - 1);
+}
+
+template <typename Data>
+const Data* OrderedDictionaryContainer<Data>::TryPredecessor(const Data& dat)
+  const noexcept {
+    ulong rank = Rank(dat);
+    if (rank == 0)
+          return nullptr;
+    return &Select(rank - 1);
+}
+
+template <typename Data>
+const Data* OrderedDictionaryContainer<Data>::TrySuccessor(const Data& dat)
+  const noexcept {
+    ulong rank = Rank(dat);
+    if (rank < this->Size() && Select(rank) == dat)
+                                          rank++;
+    if (rank >= this->Size())
+                    return nullptr;
+    return &Select(rank);
+}
+
+/* ************************************************************************** */
+
 }
@@ -140,6 +140,21 @@ public:
   virtual
   void RemoveSuccessor(const Data&) = 0; // (concrete function must throw std::length_error when not found)
 
+  virtual
+  ulong Rank(const Data&) const noexcept = 0; // Number of keys strictly less than the given one (concrete function should not throw exceptions)
+  virtual
+  const Data& Select(ulong) const = 0; // k-th smallest key, starting from 0 (concrete function must throw std::out_of_range when out of range)
+
+  // Non-throwing counterparts of the accessors above: a miss yields nullptr
+  virtual
+  const Data* TryMin() const noexcept;
+  virtual
+  const Data* TryMax() const noexcept;
+  virtual
+  const Data* TryPredecessor(const Data&) const noexcept;
+  virtual
+  const Data* TrySuccessor(const Data&) const noexcept;
+
 };
 
 /* ************************************************************************** */
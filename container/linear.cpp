@@ -154,8 +154,22 @@ void SortableLinearContainer<Data>::Sort()
     InsertionSort();
 }
 
+template<typename Data>
+template<typename Compare>
+void SortableLinearContainer<Data>::Sort(const Compare& comp)
+  noexcept {
+    InsertionSort(comp);
+}
+
 template<typename Data>
 void SortableLinearContainer<Data>::InsertionSort()
+  noexcept {
+    InsertionSort(std::less<Data>());
+}
+
+template<typename Data>
+template<typename Compare>
+void SortableLinearContainer<Data>::InsertionSort(const Compare& comp)
   noexcept {
     Data x;
     ulong i;
@@ -163,7 +177,7 @@ void SortableLinearContainer<Data>::InsertionSort()
     {
         x = (*this)[j];
         i = j;
-        while (i > 0 && (*this)[i-1] > x)
+        while (i > 0 && comp(x, (*this)[i-1]))
         {
             (*this)[i]=(*this)[i-1];
             i--;
@@ -4,6 +4,8 @@
 
 /* ************************************************************************** */
 
+#include <functional>
+
 #include "mappable.hpp"
 
 /* ************************************************************************** */
@@ -196,6 +198,9 @@ public:
   virtual
   void Sort() noexcept;
 
+  template <typename Compare>
+  void Sort(const Compare&) noexcept; // Ascending order under the given comparator (a "less than" predicate)
+
   using Container::Size;
 
 protected:
@@ -205,6 +210,9 @@ protected:
   // ...
   void InsertionSort() noexcept;
 
+  template <typename Compare>
+  void InsertionSort(const Compare&) noexcept;
+
 };
 
 /* ************************************************************************** */
@@ -0,0 +1,108 @@
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// ...
+
+template <typename Data, typename Compare>
+constexpr void InsertionSortRange(Data* buf, ulong n, const Compare& comp) {
+  for (ulong j = 1; j < n; ++j) {
+    Data moving = std::move(buf[j]);
+    ulong i = j;
+    while (i > 0 && comp(moving, buf[i - 1])) {
+      buf[i] = std::move(buf[i - 1]);
+      --i;
+    }
+    buf[i] = std::move(moving);
+  }
+}
+
+// Children of a full node are reduced pairwise, tournament style: the
+// comparisons of each round are independent and select indices without
+// branching, which the compiler can turn into conditional moves.
+template <ulong Arity, typename Data, typename Compare>
+constexpr ulong MaxChildRange(const Data* buf, ulong root, ulong heapEnd, const Compare& comp) {
+  ulong first = Arity * root + 1;
+  if (first + Arity - 1 <= heapEnd) {
+    ulong idx[Arity];
+    for (ulong k = 0; k < Arity; ++k)
+      idx[k] = first + k;
+    for (ulong width = Arity; width > 1; width >>= 1)
+      for (ulong k = 0; k < (width >> 1); ++k)
+        idx[k] = comp(buf[idx[2*k]], buf[idx[2*k+1]]) ? idx[2*k+1] : idx[2*k];
+    return idx[0];
+  }
+  ulong max = first;
+  for (ulong c = first + 1; c <= heapEnd; ++c)
+    max = comp(buf[max], buf[c]) ? c : max;
+  return max;
+}
+
+// Hole-based sift down: the sifted element is held aside while the larger
+// children move up into the hole, and it is written back once at the end.
+// Taking it by reference spares a move when a caller already holds it aside;
+// it must not be an element of the array itself.
+template <ulong Arity, typename Data, typename Compare>
+constexpr void SiftDownRange(Data* buf, ulong hole, ulong heapEnd, Data&& moving, const Compare& comp) {
+  while (Arity * hole + 1 <= heapEnd) {
+    ulong child = MaxChildRange<Arity>(buf, hole, heapEnd, comp);
+    if (!comp(moving, buf[child]))
+                        break;
+    buf[hole] = std::move(buf[child]);
+    hole = child;
+  }
+  buf[hole] = std::move(moving);
+}
+
+// The element displaced from the end of the heap is almost always small, so
+// instead of comparing it against the larger child at every level, the hole
+// is first pushed down to a leaf and the element then climbs back up the few
+// levels it needs.
+template <ulong Arity, typename Data, typename Compare>
+constexpr void SiftLeafRange(Data* buf, ulong heapEnd, Data&& moving, const Compare& comp) {
+  ulong hole = 0;
+  while (Arity * hole + 1 <= heapEnd) {
+    ulong child = MaxChildRange<Arity>(buf, hole, heapEnd, comp);
+    buf[hole] = std::move(buf[child]);
+    hole = child;
+  }
+  while (hole > 0) {
+    ulong par = (hole - 1) / Arity;
+    if (!comp(buf[par], moving))
+                        break;
+    buf[hole] = std::move(buf[par]);
+    hole = par;
+  }
+  buf[hole] = std::move(moving);
+}
+
+template <ulong Arity, typename Data, typename Compare>
+constexpr void HeapifyRange(Data* buf, ulong n, const Compare& comp) {
+  if (n <= 1) return;
+  for (ulong i = (n - 2) / Arity + 1; i > 0; --i)
+    SiftDownRange<Arity>(buf, i - 1, n - 1, Data(std::move(buf[i - 1])), comp);
+}
+
+template <ulong Arity, typename Data, typename Compare>
+constexpr void HeapSortRange(Data* buf, ulong n, const Compare& comp) {
+  if (n <= 1) return;
+  HeapifyRange<Arity>(buf, n, comp);
+  for (ulong i = n - 1; i > 0; --i) {
+    Data last = std::move(buf[i]);
+    buf[i] = std::move(buf[0]);
+    SiftLeafRange<Arity>(buf, i - 1, std::move(last), comp);
+  }
+}
+
+template <ulong Arity, typename Data, typename Compare>
+constexpr bool IsHeapRange(const Data* buf, ulong n, const Compare& comp) {
+  for (ulong i = 1; i < n; ++i)
+    if (comp(buf[(i - 1) / Arity], buf[i]))
+      return false;
+  return true;
+}
+
+/* ************************************************************************** */
+
+}
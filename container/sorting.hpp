@@ -0,0 +1,53 @@
+
+#ifndef SORTING_HPP
+#define SORTING_HPP
+
+/* ************************************************************************** */
+
+#include <utility>
+
+/* ************************************************************************** */
+
+#include "container.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Sorting and heap algorithms on a plain array of n elements, shared by
+// SortableVector, HeapVec and SetFrozen. Containers cannot be constexpr, as
+// their interfaces are virtual bases, but these functions can: applied to an
+// array inside a constexpr function they run at compile time, whenever Data
+// and Compare allow. Compare is a "less than" predicate; a heap has its
+// greatest element at index 0, each node having Arity children.
+
+template <typename Data, typename Compare>
+constexpr void InsertionSortRange(Data*, ulong, const Compare&); // Stable
+
+template <ulong Arity, typename Data, typename Compare>
+constexpr ulong MaxChildRange(const Data*, ulong, ulong, const Compare&); // Greatest child of a node within the heap ending at the given index (the node must have one)
+
+template <ulong Arity, typename Data, typename Compare>
+constexpr void SiftDownRange(Data*, ulong, ulong, Data&&, const Compare&); // Fills the hole at the given index with the given element (held outside the array), within the heap ending at the given index
+
+template <ulong Arity, typename Data, typename Compare>
+constexpr void SiftLeafRange(Data*, ulong, Data&&, const Compare&); // Fills the hole at the root with the given element (held outside the array) descending to a leaf first, within the heap ending at the given index
+
+template <ulong Arity, typename Data, typename Compare>
+constexpr void HeapifyRange(Data*, ulong, const Compare&);
+
+template <ulong Arity, typename Data, typename Compare>
+constexpr void HeapSortRange(Data*, ulong, const Compare&); // Bottom-up heapsort, ascending under Compare
+
+template <ulong Arity, typename Data, typename Compare>
+constexpr bool IsHeapRange(const Data*, ulong, const Compare&);
+
+/* ************************************************************************** */
+
+}
+
+#include "sorting.cpp"
+
+#endif
@@ -5,121 +5,140 @@ namespace lasd {
 
 // ...
 
-template <typename Data>
-HeapVec<Data>::HeapVec(const TraversableContainer<Data>& box) 
-  : Vector<Data>(box) {
+template <typename Data, ulong Arity, typename Compare>
+HeapVec<Data, Arity, Compare>::HeapVec(const Compare& comp)
+  : SortableVector<Data, Compare>(comp) {}
+
+template <typename Data, ulong Arity, typename Compare>
+HeapVec<Data, Arity, Compare>::HeapVec(std::pmr::memory_resource& res, const Compare& comp)
+  : Vector<Data>(res), SortableVector<Data, Compare>(comp) {}
+
+template <typename Data, ulong Arity, typename Compare>
+HeapVec<Data, Arity, Compare>::HeapVec(const TraversableContainer<Data>& box, const Compare& comp)
+  : Vector<Data>(box), SortableVector<Data, Compare>(comp) {
   Heapify();
 }
 
-template <typename Data>
-HeapVec<Data>::HeapVec(MappableContainer<Data>&& box) 
-  : Vector<Data>(std::move(box)) {
+template <typename Data, ulong Arity, typename Compare>
+HeapVec<Data, Arity, Compare>::HeapVec(MappableContainer<Data>&& box, const Compare& comp)
+  : Vector<Data>(std::move(box)), SortableVector<Data, Compare>(comp) {
   Heapify();
 }
 
-template <typename Data>
-HeapVec<Data>::HeapVec(const HeapVec& other) 
-  : Vector<Data>(other) {}
+template <typename Data, ulong Arity, typename Compare>
+HeapVec<Data, Arity, Compare>::HeapVec(const HeapVec& other) 
+  : Vector<Data>(other), SortableVector<Data, Compare>(other.comp) {}
 
-template <typename Data>
-HeapVec<Data>::HeapVec(HeapVec&& other) noexcept 
-  : Vector<Data>(std::move(other)) {}
+template <typename Data, ulong Arity, typename Compare>
+HeapVec<Data, Arity, Compare>::HeapVec(HeapVec&& other) noexcept 
+  : Vector<Data>(std::move(other)), SortableVector<Data, Compare>(other.comp) {}
 
-template <typename Data>
-HeapVec<Data>& HeapVec<Data>::operator=(const HeapVec<Data>& other) {
-  SortableVector<Data>::operator=(other);
+template <typename Data, ulong Arity, typename Compare>
+HeapVec<Data, Arity, Compare>& HeapVec<Data, Arity, Compare>::operator=(const HeapVec<Data, Arity, Compare>& other) {
+  SortableVector<Data, Compare>::operator=(other);
   return *this;
 }
 
-template <typename Data>
-HeapVec<Data>& HeapVec<Data>::operator=(HeapVec<Data>&& other) noexcept {
-  SortableVector<Data>::operator=(std::move(other));
+template <typename Data, ulong Arity, typename Compare>
+HeapVec<Data, Arity, Compare>& HeapVec<Data, Arity, Compare>::operator=(HeapVec<Data, Arity, Compare>&& other) noexcept {
+  SortableVector<Data, Compare>::operator=(std::move(other));
   return *this;
 }
 
-template <typename Data>
-bool HeapVec<Data>::operator==(const HeapVec<Data>& other) const noexcept {
-  return SortableVector<Data>::operator==(other);
+template <typename Data, ulong Arity, typename Compare>
+bool HeapVec<Data, Arity, Compare>::operator==(const HeapVec<Data, Arity, Compare>& other) const noexcept {
+  return SortableVector<Data, Compare>::operator==(other);
 }
 
-template <typename Data>
-bool HeapVec<Data>::operator!=(const HeapVec<Data>& other) const noexcept {
-  return SortableVector<Data>::operator!=(other);
+template <typename Data, ulong Arity, typename Compare>
+bool HeapVec<Data, Arity, Compare>::operator!=(const HeapVec<Data, Arity, Compare>& other) const noexcept {
+  return SortableVector<Data, Compare>::operator!=(other);
 }
 
-template <typename Data>
-inline bool HeapVec<Data>::IsHeap() const noexcept {
-  if (Size() <= 1) return true; // #TODO corrected: if (Size() == 0) return true; -> if (Size() <= 1) return true;
-  ulong max;
-  for (ulong i = 0; i < static_cast<ulong>(parent(Size()-1)); ++i) {
-        max = GetMax(i, Size()-1);
-    if (max != i) {
-      return false;
-    }
-  }
-  return true;
+template <typename Data, ulong Arity, typename Compare>
+inline bool HeapVec<Data, Arity, Compare>::IsHeap() const noexcept {
+  return IsHeapRange<Arity>(this->buffer, Size(), comp);
 }
 
-template <typename Data>
-void HeapVec<Data>::Heapify() noexcept {
-  if (Size() == 0) return;
-  for (ulong i = parent(Size()-1)+1; i > 0; --i) {
-    HeapifyDown(i-1, Size()-1);
-  }
+template <typename Data, ulong Arity, typename Compare>
+void HeapVec<Data, Arity, Compare>::Heapify() noexcept {
+  HeapifyRange<Arity>(this->buffer, Size(), comp);
 }
 
-template <typename Data>
-void HeapVec<Data>::HeapifyDown(ulong root, ulong heapEnd) noexcept {
-  ulong max = GetMax(root, heapEnd);
-  if (max != root) {
-    std::swap((*this)[root], (*this)[max]);
-    HeapifyDown(max, heapEnd);
-  }
+template <typename Data, ulong Arity, typename Compare>
+void HeapVec<Data, Arity, Compare>::HeapifyDown(ulong root, ulong heapEnd) noexcept {
+  SiftDown(root, heapEnd, std::move(this->buffer[root]));
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void HeapVec<Data, Arity, Compare>::SiftDown(ulong hole, ulong heapEnd, Data moving) noexcept {
+  SiftDownRange<Arity>(this->buffer, hole, heapEnd, std::move(moving), comp);
 }
 
-template <typename Data>
-inline ulong HeapVec<Data>::GetMax(ulong root, ulong heapEnd) const noexcept {
-  ulong max = root;
-  if (left(root) <= heapEnd && (*this)[left(root)] > (*this)[max])
-                                                 max = left(root);
-  if (right(root) <= heapEnd && (*this)[right(root)] > (*this)[max])
-                                                  max = right(root);
-  return max;
+template <typename Data, ulong Arity, typename Compare>
+inline ulong HeapVec<Data, Arity, Compare>::GetMax(ulong root, ulong heapEnd) const noexcept {
+  if (left(root) > heapEnd)
+            return root;
+  ulong max = MaxChild(root, heapEnd);
+  return comp(this->buffer[root], this->buffer[max]) ? max : root;
 }
 
-template <typename Data>
-inline int HeapVec<Data>::parent(ulong i) noexcept {
-  return ((i+1)>>1) - 1;
+template <typename Data, ulong Arity, typename Compare>
+inline ulong HeapVec<Data, Arity, Compare>::MaxChild(ulong root, ulong heapEnd) const noexcept {
+  return MaxChildRange<Arity>(this->buffer, root, heapEnd, comp);
 }
 
-template <typename Data>
-inline ulong HeapVec<Data>::left(ulong i) noexcept {
-  return 2 * (i + 1) - 1;
+template <typename Data, ulong Arity, typename Compare>
+inline int HeapVec<Data, Arity, Compare>::parent(ulong i) noexcept {
+  return ((i + Arity - 1) / Arity) - 1;
 }
 
-template <typename Data>
-inline ulong HeapVec<Data>::right(ulong i) noexcept {
-  return 2 * (i + 1);
+template <typename Data, ulong Arity, typename Compare>
+inline ulong HeapVec<Data, Arity, Compare>::left(ulong i) noexcept {
+  return Arity * i + 1;
 }
 
-template <typename Data>
-void HeapVec<Data>::Sort() noexcept {
+template <typename Data, ulong Arity, typename Compare>
+inline ulong HeapVec<Data, Arity, Compare>::right(ulong i) noexcept {
+  return Arity * (i + 1);
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void HeapVec<Data, Arity, Compare>::Sort() noexcept {
+  if (Size() <= 1) return;
+  BottomUpHeapSort();
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void HeapVec<Data, Arity, Compare>::TopDownSort() noexcept {
   if (Size() <= 1) return;
   HeapSort();
 }
 
-template <typename Data>
-void HeapVec<Data>::HeapSort() noexcept {
+template <typename Data, ulong Arity, typename Compare>
+void HeapVec<Data, Arity, Compare>::HeapSort() noexcept {
   if (Size() <= 1) return;
   Heapify();
   for (ulong i = Size()-1; i > 0; --i) {
-    std::swap((*this)[0], (*this)[i]);
-    HeapifyDown(0, i-1);
+    Data last = std::move(this->buffer[i]);
+    this->buffer[i] = std::move(this->buffer[0]);
+    SiftDown(0, i-1, std::move(last));
   }
 }
 
-template <typename Data>
-void HeapVec<Data>::Traverse(typename TraversableContainer<Data>::TraverseFun f)
+// Bottom-up (Wegener) heapsort.
+template <typename Data, ulong Arity, typename Compare>
+void HeapVec<Data, Arity, Compare>::BottomUpHeapSort() noexcept {
+  HeapSortRange<Arity>(this->buffer, Size(), comp);
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void HeapVec<Data, Arity, Compare>::SiftLeaf(ulong heapEnd, Data moving) noexcept {
+  SiftLeafRange<Arity>(this->buffer, heapEnd, std::move(moving), comp);
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void HeapVec<Data, Arity, Compare>::Traverse(typename TraversableContainer<Data>::TraverseFun f)
   const {
     for (ulong i = 0; i < Size(); ++i)
     {
@@ -127,8 +146,8 @@ void HeapVec<Data>::Traverse(typename TraversableContainer<Data>::TraverseFun f)
     }
 }
 
-template <typename Data>
-void HeapVec<Data>::PreOrderTraverse(typename TraversableContainer<Data>::TraverseFun f)
+template <typename Data, ulong Arity, typename Compare>
+void HeapVec<Data, Arity, Compare>::PreOrderTraverse(typename TraversableContainer<Data>::TraverseFun f)
   const {
     for (ulong i = 0; i < Size(); ++i)
     {
@@ -136,8 +155,8 @@ void HeapVec<Data>::PreOrderTraverse(typename TraversableContainer<Data>::Traver
     }
 }
 
-template <typename Data>
-void HeapVec<Data>::PostOrderTraverse(typename TraversableContainer<Data>::TraverseFun f)
+template <typename Data, ulong Arity, typename Compare>
+void HeapVec<Data, Arity, Compare>::PostOrderTraverse(typename TraversableContainer<Data>::TraverseFun f)
   const {
     for (ulong i = Size(); i > 0; --i)
     {
@@ -145,24 +164,24 @@ void HeapVec<Data>::PostOrderTraverse(typename TraversableContainer<Data>::Trave
     }
 }
 
-template <typename Data>
-const Data& HeapVec<Data>::Back() const {
+template <typename Data, ulong Arity, typename Compare>
+const Data& HeapVec<Data, Arity, Compare>::Back() const {
   if (Size() == 0) {
     throw std::length_error("Heap is empty");
   }
   return (*this)[Size() - 1];
 }
 
-template <typename Data>
-const Data& HeapVec<Data>::Front() const {
+template <typename Data, ulong Arity, typename Compare>
+const Data& HeapVec<Data, Arity, Compare>::Front() const {
   if (Size() == 0) {
     throw std::length_error("Heap is empty");
   }
   return (*this)[0];
 }
 
-template <typename Data>
-const Data& HeapVec<Data>::operator[](ulong index)
+template <typename Data, ulong Arity, typename Compare>
+const Data& HeapVec<Data, Arity, Compare>::operator[](ulong index)
   const {
   if (index >= Size()) {
     throw std::out_of_range("Index out of range");
@@ -170,20 +189,20 @@ const Data& HeapVec<Data>::operator[](ulong index)
   return this->buffer[index];
 }
 
-template <typename Data>
-Data& HeapVec<Data>::Back() {
-  return const_cast<Data&>(static_cast<const HeapVec<Data>&>(*this).Back());
+template <typename Data, ulong Arity, typename Compare>
+Data& HeapVec<Data, Arity, Compare>::Back() {
+  return const_cast<Data&>(static_cast<const HeapVec<Data, Arity, Compare>&>(*this).Back());
 }
 
-template <typename Data>
-Data& HeapVec<Data>::Front() {
-  return const_cast<Data&>(static_cast<const HeapVec<Data>&>(*this).Front());
+template <typename Data, ulong Arity, typename Compare>
+Data& HeapVec<Data, Arity, Compare>::Front() {
+  return const_cast<Data&>(static_cast<const HeapVec<Data, Arity, Compare>&>(*this).Front());
 }
 
-template <typename Data>
-Data& HeapVec<Data>::operator[](ulong index)
+template <typename Data, ulong Arity, typename Compare>
+Data& HeapVec<Data, Arity, Compare>::operator[](ulong index)
 {
-  return const_cast<Data&>(static_cast<const HeapVec<Data>&>(*this)[index]);
+  return const_cast<Data&>(static_cast<const HeapVec<Data, Arity, Compare>&>(*this)[index]);
 }
 
 
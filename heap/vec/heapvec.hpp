@@ -5,6 +5,7 @@
 /* ************************************************************************** */
 
 #include "../heap.hpp"
+#include "../../container/sorting.hpp"
 #include "../../vector/vector.hpp"
 
 /* ************************************************************************** */
@@ -13,11 +14,18 @@ namespace lasd {
 
 /* ************************************************************************** */
 
-template <typename Data>
-class HeapVec : virtual public Heap<Data>, virtual protected SortableVector<Data> {
+// Arity is the number of children per node (2 gives the classic binary heap);
+// wider nodes make the heap shallower and keep a node's children on the same
+// cache line. Compare is a "less than" predicate: the root is the greatest
+// element under it, so std::greater<Data> gives a min-heap.
+
+template <typename Data, ulong Arity = 2, typename Compare = std::less<Data>>
+class HeapVec : virtual public Heap<Data>, virtual protected SortableVector<Data, Compare> {
   // Must extend Heap<Data>,
   // Could extend SortableVector<Data>
 
+  static_assert(Arity >= 2 && (Arity & (Arity - 1)) == 0, "Arity must be a power of two");
+
 private:
 
   // ...
@@ -25,6 +33,7 @@ private:
 protected:
 
   using Container::size;
+  using SortableVector<Data, Compare>::comp;
 
   // ...
 
@@ -32,12 +41,14 @@ public:
 
   // Default constructor
   HeapVec() = default;
+  explicit HeapVec(const Compare&); // An empty heap ordered by the given comparator
 
   /* ************************************************************************ */
 
   // Specific constructors
-  HeapVec(const TraversableContainer<Data>&); // A heap obtained from a TraversableContainer
-  HeapVec(MappableContainer<Data>&&); // A heap obtained from a MappableContainer
+  HeapVec(const TraversableContainer<Data>&, const Compare& = Compare()); // A heap obtained from a TraversableContainer
+  HeapVec(MappableContainer<Data>&&, const Compare& = Compare()); // A heap obtained from a MappableContainer
+  explicit HeapVec(std::pmr::memory_resource&, const Compare& = Compare()); // An empty heap allocating from the given memory resource
 
   /* ************************************************************************ */
 
@@ -78,9 +89,12 @@ public:
 
   // Specific member function (inherited from SortableLinearContainer)
 
-  void Sort() noexcept override; // Override SortableLinearContainer member
+  void Sort() noexcept override; // Override SortableLinearContainer member (bottom-up heapsort)
+
+  void TopDownSort() noexcept; // Textbook heapsort, kept for comparison
 
   using Container::Size;
+  using Vector<Data>::Resource;
 
   void Traverse(typename TraversableContainer<Data>::TraverseFun) const override; // Override TraversableContainer member
   void PreOrderTraverse(typename TraversableContainer<Data>::TraverseFun) const override; // Override TraversableContainer member
@@ -95,11 +109,15 @@ protected:
   // Auxiliary functions, if necessary!
   
   void HeapSort() noexcept;
+  void BottomUpHeapSort() noexcept;
+  void SiftLeaf(ulong, Data) noexcept; // Fills the hole at the root descending to a leaf first
   void HeapifyDown(ulong, ulong) noexcept;
+  void SiftDown(ulong, ulong, Data) noexcept; // Fills the hole at the given index with the given element
   ulong GetMax(ulong, ulong) const noexcept;
+  ulong MaxChild(ulong, ulong) const noexcept; // (the node must have at least one child within the heap)
   static int parent(ulong) noexcept;
-  static ulong left(ulong) noexcept;
-  static ulong right(ulong) noexcept;
+  static ulong left(ulong) noexcept; // First child
+  static ulong right(ulong) noexcept; // Last child
 
   Data& Front() override;
   Data& Back() override;
@@ -40,12 +40,12 @@ inline bool List<Data>::Node::operator!=(const Node& other)
 }
 
 template <typename Data>
-inline void List<Data>::Node::Flush()
+inline void List<Data>::Node::Flush(std::pmr::memory_resource* res)
   noexcept {
     Node* current = this->next;
     while (current != nullptr) {
       Node* next = current->next;
-      delete current;
+      DeleteNode(res, current);
       current = next;
     }
 }
@@ -78,6 +78,12 @@ List<Data>::List(MappableContainer<Data>&& box)
   );
 }
 
+template <typename Data>
+List<Data>::List(std::pmr::memory_resource& res)
+  : List() {
+  resource = &res;
+}
+
 template <typename Data>
 List<Data>::List(const List<Data>& other)
 {
@@ -104,7 +110,7 @@ List<Data>& List<Data>::operator=(const List<Data>& other)
 
   Clear();
   if (!other.Empty()) {
-    head = other.Clone(tail);
+    head = other.Clone(tail, resource);
   }
   size = other.size;
   return *this;
@@ -116,6 +122,7 @@ List<Data>& List<Data>::operator=(List<Data>&& other)
     std::swap(head, other.head);
     std::swap(tail, other.tail);
     std::swap(size, other.size);
+    std::swap(resource, other.resource);
   return *this;
 }
 
@@ -147,7 +154,7 @@ inline bool List<Data>::operator!=(const List<Data>& other)
 template <typename Data>
 void List<Data>::InsertAtFront(const Data& dat)
 {
-  Node* newNode = new Node(dat);
+  Node* newNode = NewNode(resource, dat);
   if (Empty()) {
     head = newNode;
     tail = newNode;
@@ -161,7 +168,7 @@ void List<Data>::InsertAtFront(const Data& dat)
 template <typename Data>
 void List<Data>::InsertAtFront(Data&& dat)
 {
-  Node* newNode = new Node(std::move(dat));
+  Node* newNode = NewNode(resource, std::move(dat));
   if (Empty()) {
     head = newNode;
     tail = newNode;
@@ -180,7 +187,7 @@ void List<Data>::RemoveFromFront()
   }
   Node* x = head;
   head = head->next;
-  delete x;
+  DeleteNode(resource, x);
   size--;
   if (Empty()) {
     tail = nullptr;
@@ -201,7 +208,7 @@ Data List<Data>::FrontNRemove()
 template <typename Data>
 void List<Data>::InsertAtBack(const Data& dat)
 {
-  Node* newNode = new Node(dat);
+  Node* newNode = NewNode(resource, dat);
   if (Empty()) {
     head = newNode;
     tail = newNode;
@@ -215,7 +222,7 @@ void List<Data>::InsertAtBack(const Data& dat)
 template <typename Data>
 void List<Data>::InsertAtBack(Data&& dat)
 {
-  Node* newNode = new Node(std::move(dat));
+  Node* newNode = NewNode(resource, std::move(dat));
   if (Empty()) {
     head = newNode;
     tail = newNode;
@@ -233,7 +240,7 @@ void List<Data>::RemoveFromBack()
     throw std::length_error("List is empty");
   }
   if (head == tail) {
-    delete head;
+    DeleteNode(resource, head);
     head = nullptr;
     tail = nullptr;
   } else {
@@ -241,7 +248,7 @@ void List<Data>::RemoveFromBack()
     while (current->next != tail) {
       current = current->next;
     }
-    delete tail;
+    DeleteNode(resource, tail);
     tail = current;
     tail->next = nullptr;
   }
@@ -363,22 +370,22 @@ void List<Data>::PostOrderTraverse(TraverseFun fun)
 
 
 template <typename Data>
-typename List<Data>::Node* List<Data>::Clone(Node*& otherTail)
+typename List<Data>::Node* List<Data>::Clone(Node*& otherTail, std::pmr::memory_resource* res)
 const {
   if (Empty()) 
     return nullptr;
-  return head->recClone(otherTail);
+  return head->recClone(otherTail, res);
 }
 
 template <typename Data>
-typename List<Data>::Node* List<Data>::Node::recClone(Node*& otherTail) const {
+typename List<Data>::Node* List<Data>::Node::recClone(Node*& otherTail, std::pmr::memory_resource* res) const {
   
-  Node* newNode = new Node(key);
+  Node* newNode = NewNode(res, key);
   if (next == nullptr){
     otherTail = newNode;
     return newNode;
   }
-  newNode->next = next->recClone(otherTail);
+  newNode->next = next->recClone(otherTail, res);
   
   return newNode;
 }
@@ -400,18 +407,50 @@ inline void List<Data>::Clear()
     if (Empty()) return;
     ->
     if (!Empty()) {
-      head->Flush();
-      delete head;
+      head->Flush(resource);
+      DeleteNode(resource, head);
     }
     */
     if (!Empty()) {
-      head->Flush();
-      delete head;
+      head->Flush(resource);
+      DeleteNode(resource, head);
     }
     head = nullptr;
     tail = nullptr;
     size = 0;
 }
 
+template <typename Data>
+inline std::pmr::memory_resource* List<Data>::Resource()
+  const noexcept {
+    return resource;
+}
+
+// Nodes come from new and go back through delete unless the list was given a
+// resource; then each node is constructed in storage taken from it.
+template <typename Data>
+template <typename Value>
+typename List<Data>::Node* List<Data>::NewNode(std::pmr::memory_resource* res, Value&& dat) {
+  if (res == nullptr)
+    return new Node(std::forward<Value>(dat));
+  void* raw = res->allocate(sizeof(Node), alignof(Node));
+  try {
+    return new (raw) Node(std::forward<Value>(dat));
+  } catch (...) {
+    res->deallocate(raw, sizeof(Node), alignof(Node));
+    throw;
+  }
+}
+
+template <typename Data>
+void List<Data>::DeleteNode(std::pmr::memory_resource* res, Node* node) noexcept {
+  if (res == nullptr) {
+    delete node;
+    return;
+  }
+  node->~Node();
+  res->deallocate(node, sizeof(Node), alignof(Node));
+}
+
 /* ************************************************************************** */
 }
@@ -4,6 +4,10 @@
 
 /* ************************************************************************** */
 
+#include <memory_resource>
+
+/* ************************************************************************** */
+
 #include "../container/linear.hpp"
 
 /* ************************************************************************** */
@@ -70,9 +74,9 @@ protected:
     // Specific member functions
 
     // ...
-    void Flush() noexcept;
+    void Flush(std::pmr::memory_resource*) noexcept; // Frees the nodes following this one
 
-    Node* recClone(Node*& tail) const; // Recursive clone function
+    Node* recClone(Node*& tail, std::pmr::memory_resource*) const; // Recursive clone function
 
   };
 
@@ -80,6 +84,8 @@ protected:
   Node* head;
   Node* tail;
 
+  std::pmr::memory_resource* resource = nullptr; // Where nodes are allocated (nullptr: the free store)
+
 public:
 
   // Default constructor
@@ -90,6 +96,7 @@ public:
   // Specific constructor
   List(const TraversableContainer<Data>&); // A list obtained from a TraversableContainer
   List(MappableContainer<Data>&&); // A list obtained from a MappableContainer
+  explicit List(std::pmr::memory_resource&); // An empty list allocating its nodes from the given memory resource
 
   /* ************************************************************************ */
 
@@ -199,11 +206,21 @@ public:
 
   void Clear() noexcept; // Override ClearableContainer member
 
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  std::pmr::memory_resource* Resource() const noexcept; // The resource nodes are allocated from (nullptr: the free store)
+
 protected:
 
   // Auxiliary functions, if necessary!
-  
-  Node* Clone(Node*&) const;
+
+  template <typename Value>
+  static Node* NewNode(std::pmr::memory_resource*, Value&&); // A node holding the given value, from the given resource
+  static void DeleteNode(std::pmr::memory_resource*, Node*) noexcept; // Gives back a node obtained from NewNode
+
+  Node* Clone(Node*&, std::pmr::memory_resource*) const; // A copy of the nodes, allocated from the given resource
   void postorderrecursion(Node *node, TraverseFun fun) const;
 
 };
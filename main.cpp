@@ -1,6 +1,7 @@
 
 #include "zlasdtest/test.hpp"
 #include "zmytest/test.hpp"
+#include "zmytest/bench.hpp"
 
 /* ************************************************************************** */
 
@@ -12,6 +13,7 @@ int main()
 {
   std::cout << "LASD Libraries 2025" << std::endl;
   std::cout << "Type 1 for lasdtest()" << std::endl;
+  std::cout << "Type 2 for mybench()" << std::endl;
 
   std::string ans;
   std::getline(std::cin, ans); // Legge tutta la riga, anche vuota
@@ -20,6 +22,9 @@ int main()
     case '1':
       lasdtest();
       break;
+    case '2':
+      mybench();
+      break;
     default:
       mytest();
   }
@@ -0,0 +1,373 @@
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// ...
+
+template <typename Data, ulong Arity, typename Compare>
+const ulong PQAddr<Data, Arity, Compare>::initialSize = 16;
+
+template <typename Data, ulong Arity, typename Compare>
+const ulong PQAddr<Data, Arity, Compare>::absent = static_cast<ulong>(-1);
+
+template <typename Data, ulong Arity, typename Compare>
+PQAddr<Data, Arity, Compare>::PQAddr()
+  : values(initialSize), heap(initialSize), pos(initialSize), freed(initialSize), generation(initialSize) {
+  size = 0;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+PQAddr<Data, Arity, Compare>::PQAddr(const Compare& comp)
+  : PQAddr() {
+  this->comp = comp;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+PQAddr<Data, Arity, Compare>::PQAddr(const TraversableContainer<Data>& box, const Compare& comp)
+  : PQAddr(comp) {
+  Reserve(box.Size());
+  box.Traverse(
+    [this](const Data& dat)
+    {
+      ulong slot = Acquire();
+      values[size] = dat;
+      heap[size] = slot;
+      pos[slot] = size++;
+    }
+  );
+  Heapify();
+}
+
+template <typename Data, ulong Arity, typename Compare>
+PQAddr<Data, Arity, Compare>::PQAddr(MappableContainer<Data>&& box, const Compare& comp)
+  : PQAddr(comp) {
+  Reserve(box.Size());
+  box.Map(
+    [this](Data& dat)
+    {
+      ulong slot = Acquire();
+      values[size] = std::move(dat);
+      heap[size] = slot;
+      pos[slot] = size++;
+    }
+  );
+  Heapify();
+}
+
+template <typename Data, ulong Arity, typename Compare>
+PQAddr<Data, Arity, Compare>::PQAddr(const PQAddr<Data, Arity, Compare>& other)
+  : values(other.values), heap(other.heap), pos(other.pos), freed(other.freed), generation(other.generation),
+    numSlots(other.numSlots), numFreed(other.numFreed), comp(other.comp) {
+  size = other.size;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+PQAddr<Data, Arity, Compare>::PQAddr(PQAddr<Data, Arity, Compare>&& other)
+  noexcept : comp(other.comp) {
+    size = 0;
+    *this = std::move(other);
+}
+
+template <typename Data, ulong Arity, typename Compare>
+PQAddr<Data, Arity, Compare>& PQAddr<Data, Arity, Compare>::operator=(const PQAddr<Data, Arity, Compare>& other)
+{
+  if (this == &other) return *this;
+
+  PQAddr<Data, Arity, Compare> tmp(other);
+  *this = std::move(tmp);
+  return *this;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+PQAddr<Data, Arity, Compare>& PQAddr<Data, Arity, Compare>::operator=(PQAddr<Data, Arity, Compare>&& other)
+  noexcept {
+    std::swap(size, other.size);
+    std::swap(values, other.values);
+    std::swap(heap, other.heap);
+    std::swap(pos, other.pos);
+    std::swap(freed, other.freed);
+    std::swap(generation, other.generation);
+    std::swap(numSlots, other.numSlots);
+    std::swap(numFreed, other.numFreed);
+    std::swap(comp, other.comp);
+  return *this;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+bool PQAddr<Data, Arity, Compare>::operator==(const PQAddr<Data, Arity, Compare>& other)
+  const noexcept {
+    if (size != other.size)
+                  return false;
+    PQAddr<Data, Arity, Compare> sx(*this);
+    PQAddr<Data, Arity, Compare> dx(other);
+    bool diffAbsence = true;
+    while (diffAbsence && !sx.Empty())
+      diffAbsence = (sx.TipNRemove() == dx.TipNRemove());
+  return diffAbsence;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+inline bool PQAddr<Data, Arity, Compare>::operator!=(const PQAddr<Data, Arity, Compare>& other)
+  const noexcept {
+    return !(*this == other);
+}
+
+/* ************************************************************************** */
+
+template <typename Data, ulong Arity, typename Compare>
+const Data& PQAddr<Data, Arity, Compare>::Tip() const {
+  if (size == 0) {
+    throw std::length_error("Priority queue is empty");
+  }
+  return values[0];
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void PQAddr<Data, Arity, Compare>::RemoveTip() {
+  if (size == 0) {
+    throw std::length_error("Priority queue is empty");
+  }
+  Erase(0);
+}
+
+template <typename Data, ulong Arity, typename Compare>
+Data PQAddr<Data, Arity, Compare>::TipNRemove() {
+  if (size == 0) {
+    throw std::length_error("Priority queue is empty");
+  }
+  Data ret = std::move(values[0]);
+  Erase(0);
+  return ret;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+inline void PQAddr<Data, Arity, Compare>::Insert(const Data& dat) {
+  Push(dat);
+}
+
+template <typename Data, ulong Arity, typename Compare>
+inline void PQAddr<Data, Arity, Compare>::Insert(Data&& dat) {
+  Push(std::move(dat));
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void PQAddr<Data, Arity, Compare>::Change(ulong index, const Data& dat) {
+  Data copy = dat;
+  Change(index, std::move(copy));
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void PQAddr<Data, Arity, Compare>::Change(ulong index, Data&& dat) {
+  if (index >= size) {
+    throw std::out_of_range("Index out of range");
+  }
+  Update(heap[index], std::move(dat));
+}
+
+/* ************************************************************************** */
+
+template <typename Data, ulong Arity, typename Compare>
+typename PQAddr<Data, Arity, Compare>::Handle PQAddr<Data, Arity, Compare>::Push(const Data& dat) {
+  Data copy = dat;
+  return Push(std::move(copy));
+}
+
+template <typename Data, ulong Arity, typename Compare>
+typename PQAddr<Data, Arity, Compare>::Handle PQAddr<Data, Arity, Compare>::Push(Data&& dat) {
+  ulong slot = Acquire();
+  SiftUp(size++, std::move(dat), slot);
+  return Handle{slot, generation[slot]};
+}
+
+template <typename Data, ulong Arity, typename Compare>
+typename PQAddr<Data, Arity, Compare>::Handle PQAddr<Data, Arity, Compare>::TipHandle() const {
+  if (size == 0) {
+    throw std::length_error("Priority queue is empty");
+  }
+  return Handle{heap[0], generation[heap[0]]};
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void PQAddr<Data, Arity, Compare>::Change(Handle hnd, const Data& dat) {
+  Data copy = dat;
+  Update(Checked(hnd), std::move(copy));
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void PQAddr<Data, Arity, Compare>::Change(Handle hnd, Data&& dat) {
+  Update(Checked(hnd), std::move(dat));
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void PQAddr<Data, Arity, Compare>::Remove(Handle hnd) {
+  Erase(pos[Checked(hnd)]);
+}
+
+template <typename Data, ulong Arity, typename Compare>
+Data PQAddr<Data, Arity, Compare>::Extract(Handle hnd) {
+  ulong index = pos[Checked(hnd)];
+  Data ret = std::move(values[index]);
+  Erase(index);
+  return ret;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+inline bool PQAddr<Data, Arity, Compare>::Contains(Handle hnd) const noexcept {
+  return hnd.slot < numSlots && pos[hnd.slot] != absent && generation[hnd.slot] == hnd.generation;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+const Data& PQAddr<Data, Arity, Compare>::operator[](Handle hnd) const {
+  return values[pos[Checked(hnd)]];
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void PQAddr<Data, Arity, Compare>::Reserve(ulong dim) {
+  if (dim <= values.Size())
+                    return;
+  values.Resize(dim);
+  heap.Resize(dim);
+  pos.Resize(dim);
+  freed.Resize(dim);
+  generation.Resize(dim);
+}
+
+/* ************************************************************************** */
+
+template <typename Data, ulong Arity, typename Compare>
+const Data& PQAddr<Data, Arity, Compare>::operator[](ulong index) const {
+  if (index >= size) {
+    throw std::out_of_range("Index out of range");
+  }
+  return values[index];
+}
+
+// The slots are released rather than forgotten, so that their generations
+// survive and no handle taken before clearing matches a later element.
+template <typename Data, ulong Arity, typename Compare>
+void PQAddr<Data, Arity, Compare>::Clear() noexcept {
+  for (ulong i = 0; i < size; ++i) {
+    values[i] = Data();
+    Release(heap[i]);
+  }
+  size = 0;
+}
+
+/* ************************************************************************** */
+
+// Slots freed by removals are reused before new ones are handed out; the
+// four tables grow together, by doubling.
+template <typename Data, ulong Arity, typename Compare>
+ulong PQAddr<Data, Arity, Compare>::Acquire() {
+  if (numFreed > 0)
+    return freed[--numFreed];
+  if (numSlots == values.Size())
+    Reserve(std::max(initialSize, 2 * values.Size()));
+  return numSlots++;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+inline void PQAddr<Data, Arity, Compare>::Release(ulong slot) noexcept {
+  pos[slot] = absent;
+  ++generation[slot];
+  freed[numFreed++] = slot;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void PQAddr<Data, Arity, Compare>::Erase(ulong index) noexcept {
+  Release(heap[index]);
+  if (index == --size) {
+    values[size] = Data();
+    return;
+  }
+  Data moving = std::move(values[size]);
+  values[size] = Data();
+  if (index > 0 && comp(values[parent(index)], moving))
+    SiftUp(index, std::move(moving), heap[size]);
+  else
+    SiftDown(index, std::move(moving), heap[size]);
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void PQAddr<Data, Arity, Compare>::Update(ulong slot, Data&& dat) noexcept {
+  ulong index = pos[slot];
+  if (comp(values[index], dat))
+    SiftUp(index, std::move(dat), slot);
+  else
+    SiftDown(index, std::move(dat), slot);
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void PQAddr<Data, Arity, Compare>::Heapify() noexcept {
+  if (size <= 1) return;
+  for (ulong i = parent(size - 1) + 1; i > 0; --i)
+    SiftDown(i - 1, std::move(values[i - 1]), heap[i - 1]);
+}
+
+// Hole-based sifting as in PQHeap, except that every element moving into the
+// hole brings its slot along and the position map is rewritten for it. The
+// tables are walked through plain pointers, as their size is fixed here.
+template <typename Data, ulong Arity, typename Compare>
+void PQAddr<Data, Arity, Compare>::SiftUp(ulong hole, Data moving, ulong slot) noexcept {
+  Data* buf = &values[0];
+  ulong* slots = &heap[0];
+  ulong* where = &pos[0];
+  while (hole > 0) {
+    ulong par = parent(hole);
+    if (!comp(buf[par], moving))
+                        break;
+    buf[hole] = std::move(buf[par]);
+    slots[hole] = slots[par];
+    where[slots[hole]] = hole;
+    hole = par;
+  }
+  buf[hole] = std::move(moving);
+  slots[hole] = slot;
+  where[slot] = hole;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void PQAddr<Data, Arity, Compare>::SiftDown(ulong hole, Data moving, ulong slot) noexcept {
+  Data* buf = &values[0];
+  ulong* slots = &heap[0];
+  ulong* where = &pos[0];
+  while (left(hole) < size) {
+    ulong first = left(hole);
+    ulong last = std::min(first + Arity, size);
+    ulong max = first;
+    for (ulong c = first + 1; c < last; ++c)
+      max = comp(buf[max], buf[c]) ? c : max;
+    if (!comp(moving, buf[max]))
+                        break;
+    buf[hole] = std::move(buf[max]);
+    slots[hole] = slots[max];
+    where[slots[hole]] = hole;
+    hole = max;
+  }
+  buf[hole] = std::move(moving);
+  slots[hole] = slot;
+  where[slot] = hole;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+inline ulong PQAddr<Data, Arity, Compare>::Checked(Handle hnd) const {
+  if (!Contains(hnd)) {
+    throw std::out_of_range("Handle not in the priority queue");
+  }
+  return hnd.slot;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+inline ulong PQAddr<Data, Arity, Compare>::parent(ulong i) noexcept {
+  return (i - 1) / Arity;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+inline ulong PQAddr<Data, Arity, Compare>::left(ulong i) noexcept {
+  return Arity * i + 1;
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,171 @@
+
+#ifndef PQADDR_HPP
+#define PQADDR_HPP
+
+/* ************************************************************************** */
+
+#include "../pq.hpp"
+#include "../../vector/vector.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Addressable priority queue: every inserted element gets a Handle that
+// keeps naming it while the element moves around the heap, so it can be
+// changed, removed or looked up in O(log n) without knowing its position.
+// Elements are stored in heap order, each paired with the slot its handle
+// names, and a position map tells where each slot sits. A slot freed by a
+// removal is handed out again, but with a new generation: a handle carries
+// the generation of its slot, so once its element has left the queue it is
+// never taken for the element now in that slot.
+
+template <typename Data, ulong Arity = 2, typename Compare = std::less<Data>>
+class PQAddr : virtual public PQ<Data> {
+  // Must extend PQ<Data>
+
+  static_assert(Arity >= 2 && (Arity & (Arity - 1)) == 0, "Arity must be a power of two");
+
+private:
+
+  // ...
+
+protected:
+
+  using Container::size;
+
+  static const ulong initialSize;
+  static const ulong absent; // Position of a slot not in the queue
+
+  Vector<Data> values; // Heap position -> element
+  Vector<ulong> heap; // Heap position -> slot
+  Vector<ulong> pos; // Slot -> heap position (absent when free)
+  Vector<ulong> freed; // Stack of released slots
+  Vector<ulong> generation; // Slot -> times it has been released
+  ulong numSlots = 0; // Slots handed out so far
+  ulong numFreed = 0;
+
+  [[no_unique_address]] Compare comp{};
+
+public:
+
+  struct Handle {
+
+    ulong slot;
+    ulong generation;
+
+    bool operator==(const Handle&) const noexcept = default;
+
+  };
+
+  // Default constructor
+  PQAddr();
+  explicit PQAddr(const Compare&); // An empty priority queue ordered by the given comparator
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  PQAddr(const TraversableContainer<Data>&, const Compare& = Compare()); // A priority queue obtained from a TraversableContainer
+  PQAddr(MappableContainer<Data>&&, const Compare& = Compare()); // A priority queue obtained from a MappableContainer
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  PQAddr(const PQAddr&);
+
+  // Move constructor
+  PQAddr(PQAddr&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual
+  ~PQAddr() = default;
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  PQAddr& operator=(const PQAddr&);
+
+  // Move assignment
+  PQAddr& operator=(PQAddr&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const PQAddr&) const noexcept; // Same elements, whatever their heap layout
+  bool operator!=(const PQAddr&) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from PQ)
+
+  const Data& Tip() const override; // Override PQ member (must throw std::length_error when empty)
+  void RemoveTip() override; // Override PQ member (must throw std::length_error when empty)
+  Data TipNRemove() override; // Override PQ member (must throw std::length_error when empty)
+
+  void Insert(const Data&) override; // Override PQ member (Copy of the value)
+  void Insert(Data&&) override; // Override PQ member (Move of the value)
+
+  void Change(ulong, const Data&) override; // Override PQ member (Copy of the value; the index is a heap position)
+  void Change(ulong, Data&&) override; // Override PQ member (Move of the value; the index is a heap position)
+
+  /* ************************************************************************ */
+
+  // Specific member functions (addressing by handle)
+
+  Handle Push(const Data&); // Copy of the value
+  Handle Push(Data&&); // Move of the value
+
+  Handle TipHandle() const; // (must throw std::length_error when empty)
+
+  void Change(Handle, const Data&); // Copy of the value (must throw std::out_of_range when not in the queue)
+  void Change(Handle, Data&&); // Move of the value (must throw std::out_of_range when not in the queue)
+
+  void Remove(Handle); // (must throw std::out_of_range when not in the queue)
+  Data Extract(Handle); // (must throw std::out_of_range when not in the queue)
+
+  bool Contains(Handle) const noexcept;
+
+  const Data& operator[](Handle) const; // (must throw std::out_of_range when not in the queue)
+
+  void Reserve(ulong); // Room for the given number of elements without reallocation
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from LinearContainer)
+
+  const Data& operator[](ulong) const override; // Override LinearContainer member (heap order; must throw std::out_of_range when out of range)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() noexcept override; // Override ClearableContainer member (handles of the removed elements stay invalid)
+
+protected:
+
+  // Auxiliary functions, if necessary!
+
+  ulong Acquire();
+  void Release(ulong) noexcept;
+  void Erase(ulong) noexcept;
+  void Update(ulong, Data&&) noexcept;
+  void Heapify() noexcept;
+  void SiftUp(ulong, Data, ulong) noexcept; // Fills the hole at the given index with the given element and slot
+  void SiftDown(ulong, Data, ulong) noexcept; // Fills the hole at the given index with the given element and slot
+  ulong Checked(Handle) const;
+  static ulong parent(ulong) noexcept;
+  static ulong left(ulong) noexcept; // First child
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "pqaddr.cpp"
+
+#endif
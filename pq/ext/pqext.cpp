@@ -0,0 +1,296 @@
+#include <cstdlib>
+
+#include <unistd.h>
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// ...
+
+template <typename Data, typename Compare>
+PQExt<Data, Compare>::PQExt(ulong capacity, const std::filesystem::path& directory, ulong blockSize, ulong fanIn, const Compare& comp)
+  : capacity(std::max(1UL, capacity)), blockSize(std::max(1UL, blockSize)), fanIn(std::max(2UL, fanIn)), directory(directory),
+    memory(comp), merge(HeadOrder{&runs, comp}), comp(comp) {}
+
+template <typename Data, typename Compare>
+PQExt<Data, Compare>::~PQExt() {
+  Clear();
+}
+
+/* ************************************************************************** */
+
+template <typename Data, typename Compare>
+const Data& PQExt<Data, Compare>::Tip() const {
+  if (size == 0) {
+    throw std::length_error("Priority queue is empty");
+  }
+  if (FromMemory())
+    return memory.Tip();
+  const Run& run = runs[merge.Tip()];
+  return run.block[run.at];
+}
+
+template <typename Data, typename Compare>
+void PQExt<Data, Compare>::RemoveTip() {
+  if (size == 0) {
+    throw std::length_error("Priority queue is empty");
+  }
+  if (FromMemory())
+    memory.RemoveTip();
+  else
+    Advance(merge);
+  --size;
+}
+
+template <typename Data, typename Compare>
+Data PQExt<Data, Compare>::TipNRemove() {
+  Data ret = Tip();
+  RemoveTip();
+  return ret;
+}
+
+template <typename Data, typename Compare>
+void PQExt<Data, Compare>::Insert(const Data& dat) {
+  Data copy = dat;
+  Insert(std::move(copy));
+}
+
+template <typename Data, typename Compare>
+void PQExt<Data, Compare>::Insert(Data&& dat) {
+  if (memory.Size() == capacity)
+    Spill();
+  memory.Insert(std::move(dat));
+  ++size;
+}
+
+template <typename Data, typename Compare>
+inline ulong PQExt<Data, Compare>::Size() const noexcept {
+  return size;
+}
+
+template <typename Data, typename Compare>
+inline bool PQExt<Data, Compare>::Empty() const noexcept {
+  return size == 0;
+}
+
+template <typename Data, typename Compare>
+inline ulong PQExt<Data, Compare>::Runs() const noexcept {
+  return merge.Size();
+}
+
+template <typename Data, typename Compare>
+inline ulong PQExt<Data, Compare>::Resident() const noexcept {
+  return memory.Size() + merge.Size() * blockSize;
+}
+
+template <typename Data, typename Compare>
+void PQExt<Data, Compare>::Clear() noexcept {
+  for (ulong r = 0; r < runs.Size(); ++r)
+    Close(runs[r]);
+  merge.Clear();
+  memory.Clear();
+  size = 0;
+}
+
+/* ************************************************************************** */
+
+template <typename Data, typename Compare>
+inline bool PQExt<Data, Compare>::FromMemory() const noexcept {
+  if (merge.Empty())
+        return true;
+  const Data* mem = memory.TryTip();
+  const Run& run = runs[merge.Tip()];
+  return mem != nullptr && !comp(*mem, run.block[run.at]);
+}
+
+// A run file gets a fresh name of its own from mkstemp, which refuses any
+// file already there, and is unlinked as soon as it is open, so that
+// nothing is left behind whatever happens to the process.
+template <typename Data, typename Compare>
+std::FILE* PQExt<Data, Compare>::Create() {
+  std::string name = (directory / "lasd-pqext-XXXXXX").string();
+  int fd = mkstemp(name.data());
+  if (fd == -1) {
+    throw std::runtime_error("Cannot create a run file in " + directory.string());
+  }
+  unlink(name.c_str());
+  std::FILE* file = fdopen(fd, "w+b");
+  if (file == nullptr) {
+    close(fd);
+    throw std::runtime_error("Cannot create a run file in " + directory.string());
+  }
+  return file;
+}
+
+template <typename Data, typename Compare>
+void PQExt<Data, Compare>::Write(std::FILE* file, const Data* buf, ulong count) {
+  if (std::fwrite(buf, sizeof(Data), count, file) != count) {
+    throw std::runtime_error("Cannot write a run file in " + directory.string());
+  }
+}
+
+template <typename Data, typename Compare>
+void PQExt<Data, Compare>::Sync(std::FILE* file) {
+  if (std::fflush(file) != 0) {
+    throw std::runtime_error("Cannot write a run file in " + directory.string());
+  }
+}
+
+// The heap is emptied greatest first straight into the run, which is written
+// with a single sequential write; should that fail, the elements go back to
+// the heap.
+template <typename Data, typename Compare>
+void PQExt<Data, Compare>::Spill() {
+  ulong r = 0;
+  while (r < runs.Size() && runs[r].file != nullptr)
+    ++r;
+  if (r == runs.Size())
+    runs.Resize(std::max(4UL, 2 * runs.Size()));
+
+  std::FILE* file = Create();
+  Vector<Data> sorted = memory.TipNRemove(memory.Size());
+  try {
+    Write(file, &sorted[0], sorted.Size());
+    Sync(file);
+  } catch (...) {
+    std::fclose(file);
+    memory.InsertAll(std::move(sorted));
+    throw;
+  }
+  Open(r, file, sorted.Size());
+  if (merge.Size() > fanIn)
+    Compact();
+}
+
+// The fan-in smallest runs are streamed into a new run through a single
+// output block; the new run then takes the place of the first of them. The
+// runs merged are only closed once the new one is written out: should that
+// fail, they are read again from where their heads were, so that the merge
+// heap finds them as it left them.
+template <typename Data, typename Compare>
+void PQExt<Data, Compare>::Compact() {
+  Vector<ulong> live(merge.Size());
+  ulong count = 0;
+  for (ulong r = 0; r < runs.Size(); ++r)
+    if (runs[r].file != nullptr)
+      live[count++] = r;
+  for (ulong i = 0; i < fanIn; ++i) // Selection of the smallest in front
+    for (ulong j = i + 1; j < count; ++j)
+      if (Remaining(runs[live[j]]) < Remaining(runs[live[i]]))
+        std::swap(live[i], live[j]);
+
+  PQHeap<ulong, 2, HeadOrder> chosen(HeadOrder{&runs, comp});
+  PQHeap<ulong, 2, HeadOrder> rest(HeadOrder{&runs, comp});
+  Vector<long> heads(fanIn);
+  Vector<ulong> left(fanIn);
+  ulong total = 0;
+  for (ulong i = 0; i < count; ++i)
+    if (i < fanIn) {
+      chosen.Insert(live[i]);
+      heads[i] = Head(runs[live[i]]);
+      left[i] = Remaining(runs[live[i]]);
+      total += left[i];
+    } else
+      rest.Insert(live[i]);
+
+  std::FILE* file = Create();
+  try {
+    Vector<Data> out(std::min(blockSize, total));
+    ulong filled = 0;
+    while (!chosen.Empty()) {
+      const Run& run = runs[chosen.Tip()];
+      out[filled++] = run.block[run.at];
+      if (filled == out.Size()) {
+        Write(file, &out[0], filled);
+        filled = 0;
+      }
+      Advance(chosen, false);
+    }
+    if (filled > 0)
+      Write(file, &out[0], filled);
+    Sync(file);
+  } catch (...) {
+    std::fclose(file);
+    for (ulong i = 0; i < fanIn; ++i)
+      Rewind(runs[live[i]], heads[i], left[i]);
+    throw;
+  }
+  merge = std::move(rest);
+  for (ulong i = 0; i < fanIn; ++i)
+    Close(runs[live[i]]);
+  Open(live[0], file, total);
+}
+
+template <typename Data, typename Compare>
+void PQExt<Data, Compare>::Open(ulong r, std::FILE* file, ulong length) {
+  std::rewind(file);
+  Run& run = runs[r];
+  run.file = file;
+  run.onDisk = length;
+  run.block = Vector<Data>(std::min(blockSize, length));
+  Refill(run);
+  merge.Insert(r);
+}
+
+template <typename Data, typename Compare>
+void PQExt<Data, Compare>::Refill(Run& run) {
+  ulong count = std::min(run.onDisk, run.block.Size());
+  if (std::fread(&run.block[0], sizeof(Data), count, run.file) != count) {
+    throw std::runtime_error("Cannot read a run file");
+  }
+  run.onDisk -= count;
+  run.at = 0;
+  run.filled = count;
+}
+
+// The head of the run at the tip of the merge heap moves on; the run sinks
+// to its place again, or leaves the merge heap when it is over.
+template <typename Data, typename Compare>
+void PQExt<Data, Compare>::Advance(PQHeap<ulong, 2, HeadOrder>& heads, bool close) {
+  Run& run = runs[heads.Tip()];
+  if (++run.at == run.filled) {
+    if (run.onDisk == 0) {
+      if (close)
+        Close(run);
+      heads.RemoveTip();
+      return;
+    }
+    Refill(run);
+  }
+  heads.HeapifyDown(0, heads.Size() - 1);
+}
+
+template <typename Data, typename Compare>
+inline long PQExt<Data, Compare>::Head(const Run& run) const {
+  return std::ftell(run.file) - static_cast<long>((run.filled - run.at) * sizeof(Data));
+}
+
+template <typename Data, typename Compare>
+void PQExt<Data, Compare>::Rewind(Run& run, long head, ulong left) {
+  if (std::fseek(run.file, head, SEEK_SET) != 0) {
+    throw std::runtime_error("Cannot read a run file");
+  }
+  run.onDisk = left;
+  Refill(run);
+}
+
+template <typename Data, typename Compare>
+void PQExt<Data, Compare>::Close(Run& run) noexcept {
+  if (run.file == nullptr)
+                return;
+  std::fclose(run.file);
+  run.file = nullptr;
+  run.onDisk = 0;
+  run.block = Vector<Data>();
+  run.at = run.filled = 0;
+}
+
+template <typename Data, typename Compare>
+inline ulong PQExt<Data, Compare>::Remaining(const Run& run) const noexcept {
+  return run.onDisk + run.filled - run.at;
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,154 @@
+
+#ifndef PQEXT_HPP
+#define PQEXT_HPP
+
+/* ************************************************************************** */
+
+#include <cstdio>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+/* ************************************************************************** */
+
+#include "../heap/pqheap.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// External-memory priority queue for backlogs larger than RAM. Insertions go
+// to a PQHeap of bounded size; when it fills up, its elements are written out
+// in order, greatest first, as a run in a temporary file, and the heap starts
+// over empty. Each run is then read back sequentially, one block at a time,
+// and a small merge heap over the runs (ordered by their current heads)
+// together with the in-memory heap yields the tip. Once a spill leaves more
+// live runs than the fan-in, the smallest of them (as many as the fan-in)
+// are merged into a single run, so that runs of similar length are merged
+// together and each element is rewritten a logarithmic number of times.
+// Memory thus stays within the heap bound plus one block per run, at most
+// fan-in plus two blocks, and so does the number of open files.
+// Elements are stored as raw bytes, so they must be trivially copyable. Not
+// a PQ<Data>: elements on disk have no position to access or change.
+
+template <typename Data, typename Compare = std::less<Data>>
+class PQExt {
+
+  static_assert(std::is_trivially_copyable_v<Data>, "PQExt stores elements as raw bytes");
+
+private:
+
+  // ...
+
+protected:
+
+  struct Run {
+
+    std::FILE* file = nullptr; // nullptr for a slot not in use
+    ulong onDisk = 0; // Elements not yet read into the block
+    Vector<Data> block;
+    ulong at = 0; // Head of the run within the block
+    ulong filled = 0;
+
+    bool operator==(const Run&) const noexcept = default;
+
+  };
+
+  // Orders run indices by the heads of the runs
+  struct HeadOrder {
+
+    const Vector<Run>* runs = nullptr;
+    [[no_unique_address]] Compare comp{};
+
+    bool operator()(ulong sx, ulong dx) const { return comp((*runs)[sx].block[(*runs)[sx].at], (*runs)[dx].block[(*runs)[dx].at]); }
+
+  };
+
+  ulong size = 0;
+  ulong capacity = 0; // Bound of the in-memory heap
+  ulong blockSize = 0;
+  ulong fanIn = 0; // Live runs allowed before the smallest are merged
+  std::filesystem::path directory;
+
+  PQHeap<Data, 2, Compare> memory;
+  Vector<Run> runs;
+  PQHeap<ulong, 2, HeadOrder> merge; // Live runs, the one with the greatest head at the tip
+
+  [[no_unique_address]] Compare comp{};
+
+public:
+
+  // Specific constructors
+  PQExt(ulong, const std::filesystem::path& = std::filesystem::temp_directory_path(), ulong = 4096, ulong = 16, const Compare& = Compare()); // Elements kept in memory, directory for the runs, elements per block, runs merged at once (at least 2)
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  PQExt(const PQExt&) = delete; // Copy of a queue backed by files is not possible.
+
+  // Move constructor
+  PQExt(PQExt&&) = delete; // Move of a queue backed by files is not possible.
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual
+  ~PQExt();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  PQExt& operator=(const PQExt&) = delete; // Copy assignment of a queue backed by files is not possible.
+
+  // Move assignment
+  PQExt& operator=(PQExt&&) = delete; // Move assignment of a queue backed by files is not possible.
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  const Data& Tip() const; // (must throw std::length_error when empty)
+  void RemoveTip(); // (must throw std::length_error when empty)
+  Data TipNRemove(); // (must throw std::length_error when empty)
+
+  void Insert(const Data&); // Copy of the value (must throw std::runtime_error when a run cannot be written)
+  void Insert(Data&&); // Move of the value (must throw std::runtime_error when a run cannot be written)
+
+  ulong Size() const noexcept;
+  bool Empty() const noexcept;
+
+  ulong Runs() const noexcept; // Runs still being merged
+  ulong Resident() const noexcept; // Elements held in memory, blocks included
+
+  void Clear() noexcept;
+
+protected:
+
+  // Auxiliary functions, if necessary!
+
+  bool FromMemory() const noexcept; // Whether the tip is in the in-memory heap
+  std::FILE* Create(); // An anonymous run file (must throw std::runtime_error when it cannot be created)
+  void Write(std::FILE*, const Data*, ulong); // (must throw std::runtime_error when it cannot be written)
+  void Sync(std::FILE*); // Pushes out what is still buffered (must throw std::runtime_error when it cannot be written)
+  void Spill();
+  void Compact(); // Merges the smallest runs into one
+  void Open(ulong, std::FILE*, ulong); // Makes a written run file live, given its slot and length
+  void Refill(Run&);
+  void Advance(PQHeap<ulong, 2, HeadOrder>&, bool = true); // Moves on the head of the run at the tip of the given merge heap, closing the run when over unless told not to
+  long Head(const Run&) const; // File offset of the head of the run
+  void Rewind(Run&, long, ulong); // Reads the run again from the given offset, with the given elements left
+  void Close(Run&) noexcept;
+  ulong Remaining(const Run&) const noexcept;
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "pqext.cpp"
+
+#endif
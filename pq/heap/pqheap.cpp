@@ -5,154 +5,299 @@ namespace lasd {
 
 // ...
 
-template <typename Data>
-const ulong PQHeap<Data>::initialSize = 10;
+template <typename Data, ulong Arity, typename Compare>
+const ulong PQHeap<Data, Arity, Compare>::initialSize = 10;
 
-template <typename Data>
-PQHeap<Data>::PQHeap()
+template <typename Data, ulong Arity, typename Compare>
+PQHeap<Data, Arity, Compare>::PQHeap()
 : Vector<Data>(initialSize), heapSize(0) {}
 
-template <typename Data>
-PQHeap<Data>::PQHeap(const TraversableContainer<Data>& box)
-: Vector<Data>(box), HeapVec<Data>(box), heapSize(box.Size()) {}
+template <typename Data, ulong Arity, typename Compare>
+PQHeap<Data, Arity, Compare>::PQHeap(const Compare& comp)
+: Vector<Data>(initialSize), SortableVector<Data, Compare>(comp), heapSize(0) {}
 
-template <typename Data>
-PQHeap<Data>::PQHeap(MappableContainer<Data>&& box)
-: Vector<Data>(std::move(box)), HeapVec<Data>(std::move(box)), heapSize(box.Size()) {}
+template <typename Data, ulong Arity, typename Compare>
+PQHeap<Data, Arity, Compare>::PQHeap(std::pmr::memory_resource& res, const Compare& comp)
+: Vector<Data>(initialSize, res), SortableVector<Data, Compare>(comp), heapSize(0) {}
 
-template <typename Data>
-PQHeap<Data>::PQHeap(const PQHeap& other)
-: Vector<Data>(other), heapSize(other.heapSize) {}
+template <typename Data, ulong Arity, typename Compare>
+PQHeap<Data, Arity, Compare>::PQHeap(const TraversableContainer<Data>& box, const Compare& comp)
+: Vector<Data>(box), SortableVector<Data, Compare>(comp), HeapVec<Data, Arity, Compare>(box, comp), heapSize(box.Size()) {}
 
-template <typename Data>
-PQHeap<Data>::PQHeap(PQHeap&& other) noexcept
-: Vector<Data>(std::move(other))
+template <typename Data, ulong Arity, typename Compare>
+PQHeap<Data, Arity, Compare>::PQHeap(MappableContainer<Data>&& box, const Compare& comp)
+: Vector<Data>(std::move(box)), SortableVector<Data, Compare>(comp), HeapVec<Data, Arity, Compare>(std::move(box), comp), heapSize(box.Size()) {}
+
+template <typename Data, ulong Arity, typename Compare>
+PQHeap<Data, Arity, Compare>::PQHeap(const PQHeap& other)
+: Vector<Data>(other), SortableVector<Data, Compare>(other.comp), heapSize(other.heapSize), pending(other.pending) {}
+
+template <typename Data, ulong Arity, typename Compare>
+PQHeap<Data, Arity, Compare>::PQHeap(PQHeap&& other) noexcept
+: Vector<Data>(std::move(other)), SortableVector<Data, Compare>(other.comp)
 {
   std::swap(heapSize, other.heapSize);
+  std::swap(pending, other.pending);
 }
 
-template <typename Data>
-PQHeap<Data>& PQHeap<Data>::operator=(const PQHeap<Data>& other) {
-  HeapVec<Data>::operator=(other);
+template <typename Data, ulong Arity, typename Compare>
+PQHeap<Data, Arity, Compare>& PQHeap<Data, Arity, Compare>::operator=(const PQHeap<Data, Arity, Compare>& other) {
+  HeapVec<Data, Arity, Compare>::operator=(other);
   heapSize = other.heapSize;
+  pending = other.pending;
   return *this;
 }
 
-template <typename Data>
-PQHeap<Data>& PQHeap<Data>::operator=(PQHeap<Data>&& other) noexcept {
-  HeapVec<Data>::operator=(std::move(other));
+template <typename Data, ulong Arity, typename Compare>
+PQHeap<Data, Arity, Compare>& PQHeap<Data, Arity, Compare>::operator=(PQHeap<Data, Arity, Compare>&& other) noexcept {
+  HeapVec<Data, Arity, Compare>::operator=(std::move(other));
   std::swap(heapSize, other.heapSize);
+  std::swap(pending, other.pending);
   return *this;
 }
 
-template <typename Data>
-bool PQHeap<Data>::operator==(const PQHeap<Data>& other) const noexcept {
-  HeapVec<Data> sx = *this;
-  HeapVec<Data> dx = other;
+template <typename Data, ulong Arity, typename Compare>
+bool PQHeap<Data, Arity, Compare>::operator==(const PQHeap<Data, Arity, Compare>& other) const noexcept {
+  HeapVec<Data, Arity, Compare> sx = *this;
+  HeapVec<Data, Arity, Compare> dx = other;
   sx.Sort();
   dx.Sort();
-  return sx.SortableVector<Data>::operator==(dx);
+  return sx.SortableVector<Data, Compare>::operator==(dx);
 }
 
-template <typename Data>
-bool PQHeap<Data>::operator!=(const PQHeap<Data>& other) const noexcept {
+template <typename Data, ulong Arity, typename Compare>
+bool PQHeap<Data, Arity, Compare>::operator!=(const PQHeap<Data, Arity, Compare>& other) const noexcept {
   return !(*this == other);
 }
 
-template <typename Data>
-const Data& PQHeap<Data>::Tip() const {
+template <typename Data, ulong Arity, typename Compare>
+const Data& PQHeap<Data, Arity, Compare>::Tip() const {
   if (heapSize == 0) {
     throw std::length_error("Heap is empty");
   }
+  if (pending > 0)
+    return *PendingTip();
   return Front();
 }
 
-template <typename Data>
-void PQHeap<Data>::RemoveTip() {
+template <typename Data, ulong Arity, typename Compare>
+void PQHeap<Data, Arity, Compare>::RemoveTip() {
   
   if (heapSize == 0) {
     throw std::length_error("Heap is empty");
   }
 
+  Flush();
+
   if (heapSize == 1) {
     Clear();
     return;
   }
 
-  std::swap((*this)[0], (*this)[heapSize - 1]);
-  HeapifyDown(0, heapSize - 2);
+  SiftDown(0, heapSize - 2, std::move(this->buffer[heapSize - 1]));
   
   --heapSize;
   EnsureCapacity(heapSize);
 }
 
-template <typename Data>
-Data PQHeap<Data>::TipNRemove() {
-  Data tip = Tip();
+template <typename Data, ulong Arity, typename Compare>
+Data PQHeap<Data, Arity, Compare>::TipNRemove() {
+  if (heapSize == 0) {
+    throw std::length_error("Heap is empty");
+  }
+  Flush();
+  Data tip = std::move(this->buffer[0]);
   RemoveTip();
   return tip;
 }
 
-template <typename Data>
-void PQHeap<Data>::Insert(const Data& value) {
-  EnsureCapacity(heapSize + 1);
-  ++heapSize;
-  (*this)[heapSize-1] = value;
-  HeapifyUp(heapSize - 1);
+// A few elements are popped one after the other; once k log n exceeds n,
+// selecting them all at once and heapifying the rest is cheaper than k sift
+// downs, each of which misses the cache on a large heap.
+template <typename Data, ulong Arity, typename Compare>
+Vector<Data> PQHeap<Data, Arity, Compare>::TipNRemove(ulong k) {
+  if (k > heapSize) {
+    throw std::length_error("Not enough elements in the heap");
+  }
+  Flush();
+  Vector<Data> ret(k);
+  if (k * std::bit_width(heapSize) > heapSize)
+    SelectInto(ret);
+  else
+    PopInto(ret);
+  if (heapSize == 0)
+    Clear();
+  else
+    EnsureCapacity(heapSize);
+  return ret;
 }
 
-template <typename Data>
-void PQHeap<Data>::Insert(Data&& value) {
+template <typename Data, ulong Arity, typename Compare>
+inline const Data* PQHeap<Data, Arity, Compare>::TryTip() const noexcept {
+  if (pending > 0)
+    return PendingTip();
+  return (heapSize == 0) ? nullptr : &this->buffer[0];
+}
+
+template <typename Data, ulong Arity, typename Compare>
+std::optional<Data> PQHeap<Data, Arity, Compare>::TryTipNRemove() {
+  if (heapSize == 0)
+    return std::nullopt;
+  Flush();
+  Data tip = std::move(this->buffer[0]);
+  RemoveTip();
+  return tip;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void PQHeap<Data, Arity, Compare>::Insert(const Data& value) {
+  Data copy = value;
+  Insert(std::move(copy));
+}
+
+// While a batch is pending, a single element simply joins it.
+template <typename Data, ulong Arity, typename Compare>
+void PQHeap<Data, Arity, Compare>::Insert(Data&& value) {
   EnsureCapacity(heapSize + 1);
   ++heapSize;
-  (*this)[heapSize-1] = std::move(value);
-  HeapifyUp(heapSize - 1);
+  if (pending > 0) {
+    this->buffer[heapSize - 1] = std::move(value);
+    ++pending;
+    return;
+  }
+  SiftUp(heapSize - 1, std::move(value));
 }
 
-template <typename Data>
-void PQHeap<Data>::Change(ulong index, const Data& value) {
-  
-  Data oldValue = (*this)[index];
-  (*this)[index] = value;
+template <typename Data, ulong Arity, typename Compare>
+void PQHeap<Data, Arity, Compare>::Change(ulong index, const Data& value) {
+  Data copy = value;
+  Change(index, std::move(copy));
+}
 
-  if (value > oldValue) {
-    HeapifyUp(index);
-  } else if (value < oldValue) {
-    HeapifyDown(index, heapSize - 1);
+// Positions stay put while a batch is pending: an element of the batch is
+// simply overwritten, one of the ordered part sifts within that part.
+template <typename Data, ulong Arity, typename Compare>
+void PQHeap<Data, Arity, Compare>::Change(ulong index, Data&& value) {
+  
+  const Data& oldValue = (*this)[index];
+
+  if (index >= heapSize - pending) {
+    (*this)[index] = std::move(value);
+  } else if (comp(oldValue, value)) {
+    SiftUp(index, std::move(value));
+  } else if (comp(value, oldValue)) {
+    SiftDown(index, heapSize - pending - 1, std::move(value));
+  } else {
+    (*this)[index] = std::move(value);
   }
 }
 
-template <typename Data>
-void PQHeap<Data>::Change(ulong index, Data&& value) {
-  
-  Data oldValue = (*this)[index];
-  (*this)[index] = std::move(value);
+template <typename Data, ulong Arity, typename Compare>
+void PQHeap<Data, Arity, Compare>::InsertAll(const TraversableContainer<Data>& box) {
+  Reserve(heapSize + box.Size());
+  box.Traverse(
+    [this](const Data& dat)
+    {
+      this->buffer[heapSize++] = dat;
+    }
+  );
+  pending += box.Size();
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void PQHeap<Data, Arity, Compare>::InsertAll(MappableContainer<Data>&& box) {
+  Reserve(heapSize + box.Size());
+  box.Map(
+    [this](Data& dat)
+    {
+      this->buffer[heapSize++] = std::move(dat);
+    }
+  );
+  pending += box.Size();
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void PQHeap<Data, Arity, Compare>::HeapifyUp(ulong child) noexcept {
+  SiftUp(child, std::move(this->buffer[child]));
+}
 
-  if (value > oldValue) {
-    HeapifyUp(index);
-  } else if (value < oldValue) {
-    HeapifyDown(index, heapSize - 1);
+// Hole-based sift up: smaller parents move down into the hole and the
+// element is written back once, where it stops.
+template <typename Data, ulong Arity, typename Compare>
+void PQHeap<Data, Arity, Compare>::SiftUp(ulong hole, Data moving) noexcept {
+  Data* buf = this->buffer;
+  while (hole > 0) {
+    ulong parentIdx = parent(hole);
+    if (!comp(buf[parentIdx], moving))
+                            break;
+    buf[hole] = std::move(buf[parentIdx]);
+    hole = parentIdx;
   }
+  buf[hole] = std::move(moving);
 }
 
-template <typename Data>
-void PQHeap<Data>::HeapifyUp(ulong child) noexcept {
-  
-  if (child == 0) return;
+// Sifting a batch of k elements up into a heap of n costs k log n at worst,
+// heapifying the whole n + k at most a small multiple of n + k.
+template <typename Data, ulong Arity, typename Compare>
+void PQHeap<Data, Arity, Compare>::Flush() {
+  if (pending == 0)
+          return;
+  ulong ordered = heapSize - pending;
+  if (pending * std::bit_width(heapSize) > 4 * heapSize)
+    this->Heapify();
+  else
+    for (ulong i = ordered; i < heapSize; ++i)
+      HeapifyUp(i);
+  pending = 0;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+const Data* PQHeap<Data, Arity, Compare>::PendingTip() const noexcept {
+  const Data* buf = this->buffer;
+  const Data* tip = &buf[0];
+  for (ulong i = heapSize - pending; i < heapSize; ++i)
+    if (comp(*tip, buf[i]))
+      tip = &buf[i];
+  return tip;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void PQHeap<Data, Arity, Compare>::Reserve(ulong dim) {
+  if (size < dim)
+    Resize(std::max(dim, static_cast<ulong>(std::ceil(1.5 * size))));
+}
+
+// Partial bottom-up heapsort: each tip is moved out and the hole it leaves
+// is filled from the end of the heap.
+template <typename Data, ulong Arity, typename Compare>
+void PQHeap<Data, Arity, Compare>::PopInto(Vector<Data>& ret) noexcept {
+  Data* buf = this->buffer;
+  for (ulong i = 0; i < ret.Size(); ++i) {
+    ret[i] = std::move(buf[0]);
+    if (--heapSize > 0)
+      this->SiftLeaf(heapSize - 1, std::move(buf[heapSize]));
+  }
+}
 
-  ulong parentIdx, max;
-  do {
-    parentIdx = parent(child);
-    max = GetMax(parentIdx, child);
-    if (max == child) {
-      std::swap((*this)[parentIdx], (*this)[child]);
-      child = parentIdx;
-    } 
-  } while (child > 0 && max != parentIdx);
+// The greatest k are selected to the front and sorted there, and the rest
+// slides down and is heapified again.
+template <typename Data, ulong Arity, typename Compare>
+void PQHeap<Data, Arity, Compare>::SelectInto(Vector<Data>& ret) {
+  Data* buf = this->buffer;
+  ulong k = ret.Size();
+  auto greater = [this](const Data& sx, const Data& dx) { return comp(dx, sx); };
+  std::nth_element(buf, buf + k, buf + heapSize, greater);
+  std::sort(buf, buf + k, greater);
+  for (ulong i = 0; i < k; ++i)
+    ret[i] = std::move(buf[i]);
+  for (ulong i = k; i < heapSize; ++i)
+    buf[i - k] = std::move(buf[i]);
+  heapSize -= k;
+  this->Heapify();
 }
 
-template <typename Data>
-void PQHeap<Data>::EnsureCapacity(ulong dim)
+template <typename Data, ulong Arity, typename Compare>
+void PQHeap<Data, Arity, Compare>::EnsureCapacity(ulong dim)
 {
   float resizingFactor = 1.5;
   
@@ -173,30 +318,33 @@ void PQHeap<Data>::EnsureCapacity(ulong dim)
                     Resize(static_cast<ulong>(heapSize*resizingFactor));
 }
 
-template <typename Data>
-void PQHeap<Data>::Resize(ulong newSize)
+template <typename Data, ulong Arity, typename Compare>
+void PQHeap<Data, Arity, Compare>::Resize(ulong newSize)
 {
   if (newSize == 0) {
     this->Vector<Data>::Clear();
   }
 
-  PQHeap<Data> oldPQ(std::move(*this));
-  this->buffer = new Data[newSize];
+  PQHeap<Data, Arity, Compare> oldPQ(std::move(*this));
+  this->resource = oldPQ.resource;
+  this->buffer = this->Allocate(newSize);
   this->size = newSize;
   heapSize = oldPQ.heapSize;
+  pending = oldPQ.pending;
 
   oldPQ.Transfer(*this, 0, oldPQ.heapSize, 0);
 }
 
-template <typename Data>
-void PQHeap<Data>::Clear() noexcept {
+template <typename Data, ulong Arity, typename Compare>
+void PQHeap<Data, Arity, Compare>::Clear() noexcept {
   heapSize = 0;
+  pending = 0;
   EnsureCapacity(heapSize);
   return;
 }
 
-template <typename Data>
-ulong PQHeap<Data>::Size() const noexcept {
+template <typename Data, ulong Arity, typename Compare>
+ulong PQHeap<Data, Arity, Compare>::Size() const noexcept {
   return heapSize;
 }
 
@@ -4,6 +4,11 @@
 
 /* ************************************************************************** */
 
+#include <algorithm>
+#include <bit>
+
+/* ************************************************************************** */
+
 #include "../pq.hpp"
 #include "../../heap/vec/heapvec.hpp"
 
@@ -13,8 +18,16 @@ namespace lasd {
 
 /* ************************************************************************** */
 
-template <typename Data>
-class PQHeap : virtual public PQ<Data>, virtual protected HeapVec<Data> {
+// The tip is the greatest element under Compare, so std::greater<Data> gives
+// a min-priority queue.
+// InsertAll appends a batch past the heap without ordering it; the batch is
+// merged in on the next removal of the tip, by sifting each element up or by
+// heapifying everything, whichever is cheaper for its size. Until then Tip
+// and TryTip scan the batch; a caller about to read the tip many times can
+// Flush first.
+
+template <typename Data, ulong Arity = 2, typename Compare = std::less<Data>>
+class PQHeap : virtual public PQ<Data>, virtual protected HeapVec<Data, Arity, Compare> {
   // Must extend PQ<Data>,
   // Could extend HeapVec<Data>
 
@@ -26,6 +39,7 @@ protected:
 
   using Container::size;
   ulong heapSize = 0;
+  ulong pending = 0; // Last elements of the heap not yet in heap order
   static const ulong initialSize;
 
   // ...
@@ -34,12 +48,14 @@ public:
 
   // Default constructor
   PQHeap();
+  explicit PQHeap(const Compare&); // An empty priority queue ordered by the given comparator
 
   /* ************************************************************************ */
 
   // Specific constructors
-  PQHeap(const TraversableContainer<Data>&); // A priority queue obtained from a TraversableContainer
-  PQHeap(MappableContainer<Data>&&); // A priority queue obtained from a MappableContainer
+  PQHeap(const TraversableContainer<Data>&, const Compare& = Compare()); // A priority queue obtained from a TraversableContainer
+  PQHeap(MappableContainer<Data>&&, const Compare& = Compare()); // A priority queue obtained from a MappableContainer
+  explicit PQHeap(std::pmr::memory_resource&, const Compare& = Compare()); // An empty priority queue allocating from the given memory resource
 
   /* ************************************************************************ */
 
@@ -67,9 +83,10 @@ public:
 
   // Specific member functions (inherited from PQ)
 
-  const Data& Tip() const override; // Override PQ member (must throw std::length_error when empty)
+  const Data& Tip() const override; // Override PQ member (linear in the pending batch, if any; must throw std::length_error when empty)
   void RemoveTip() override; // Override PQ member (must throw std::length_error when empty)
-  Data TipNRemove() override; // Override PQ member (must throw std::length_error when empty)
+  Data TipNRemove() override; // Override PQ member (the tip is moved out; must throw std::length_error when empty)
+  Vector<Data> TipNRemove(ulong); // The given number of greatest elements, greatest first, moved out (must throw std::length_error when fewer)
 
   void Insert(const Data&) override; // Override PQ member (Copy of the value)
   void Insert(Data&&) override; // Override PQ member (Move of the value)
@@ -77,32 +94,47 @@ public:
   void Change(ulong, const Data&) override; // Override PQ member (Copy of the value)
   void Change(ulong, Data&&) override; // Override PQ member (Move of the value)
 
-  bool operator==(const PQHeap<Data>&) const noexcept;
-  bool operator!=(const PQHeap<Data>&) const noexcept;
+  void InsertAll(const TraversableContainer<Data>&); // Copy of the values (ordered lazily)
+  void InsertAll(MappableContainer<Data>&&); // Move of the values (ordered lazily)
+  void Flush(); // Merges the pending batch now, so that Tip and TryTip read the root again
+
+  const Data* TryTip() const noexcept override; // Override PQ member
+  std::optional<Data> TryTipNRemove() override; // Override PQ member
+
+  bool operator==(const PQHeap<Data, Arity, Compare>&) const noexcept;
+  bool operator!=(const PQHeap<Data, Arity, Compare>&) const noexcept;
 
   void Clear() noexcept override; // Override ClearableContainer member
 
   ulong Size() const noexcept override;
 
   using LinearContainer<Data>::Front;
-  using HeapVec<Data>::HeapifyDown;
-  using HeapVec<Data>::Traverse;
-  using HeapVec<Data>::PreOrderTraverse;
-  using HeapVec<Data>::PostOrderTraverse;
-  using HeapVec<Data>::Empty;
+  using HeapVec<Data, Arity, Compare>::HeapifyDown;
+  using HeapVec<Data, Arity, Compare>::Traverse;
+  using HeapVec<Data, Arity, Compare>::PreOrderTraverse;
+  using HeapVec<Data, Arity, Compare>::PostOrderTraverse;
+  using HeapVec<Data, Arity, Compare>::Empty;
+  using HeapVec<Data, Arity, Compare>::Resource;
 
 protected:
 
   // Auxiliary functions, if necessary!
 
   void HeapifyUp(ulong) noexcept;
+  const Data* PendingTip() const noexcept;
+  void Reserve(ulong);
+  void PopInto(Vector<Data>&) noexcept;
+  void SelectInto(Vector<Data>&);
+  void SiftUp(ulong, Data) noexcept; // Fills the hole at the given index with the given element
   void Resize(ulong) override;
   void EnsureCapacity(ulong) override;
 
-  using HeapVec<Data>::GetMax;
-  using HeapVec<Data>::parent;
-  using HeapVec<Data>::left;
-  using HeapVec<Data>::right;
+  using HeapVec<Data, Arity, Compare>::comp;
+  using HeapVec<Data, Arity, Compare>::SiftDown;
+  using HeapVec<Data, Arity, Compare>::GetMax;
+  using HeapVec<Data, Arity, Compare>::parent;
+  using HeapVec<Data, Arity, Compare>::left;
+  using HeapVec<Data, Arity, Compare>::right;
 
 };
 
@@ -0,0 +1,400 @@
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// ...
+
+template <typename Data, typename Compare>
+const ulong PQMinMax<Data, Compare>::initialSize = 10;
+
+template <typename Data, typename Compare>
+PQMinMax<Data, Compare>::PQMinMax()
+  : Vector<Data>(initialSize), heapSize(0) {}
+
+template <typename Data, typename Compare>
+PQMinMax<Data, Compare>::PQMinMax(const Compare& comp)
+  : Vector<Data>(initialSize), SortableVector<Data, Compare>(comp), heapSize(0) {}
+
+template <typename Data, typename Compare>
+PQMinMax<Data, Compare>::PQMinMax(const TraversableContainer<Data>& box, const Compare& comp)
+  : Vector<Data>(box), SortableVector<Data, Compare>(comp), heapSize(box.Size()) {
+  Heapify();
+}
+
+template <typename Data, typename Compare>
+PQMinMax<Data, Compare>::PQMinMax(MappableContainer<Data>&& box, const Compare& comp)
+  : Vector<Data>(std::move(box)), SortableVector<Data, Compare>(comp), heapSize(box.Size()) {
+  Heapify();
+}
+
+template <typename Data, typename Compare>
+PQMinMax<Data, Compare>::PQMinMax(const PQMinMax<Data, Compare>& other)
+  : Vector<Data>(other), SortableVector<Data, Compare>(other.comp), heapSize(other.heapSize) {}
+
+template <typename Data, typename Compare>
+PQMinMax<Data, Compare>::PQMinMax(PQMinMax<Data, Compare>&& other) noexcept
+  : Vector<Data>(std::move(other)), SortableVector<Data, Compare>(other.comp) {
+  std::swap(heapSize, other.heapSize);
+}
+
+template <typename Data, typename Compare>
+PQMinMax<Data, Compare>& PQMinMax<Data, Compare>::operator=(const PQMinMax<Data, Compare>& other) {
+  if (this == &other) return *this;
+
+  PQMinMax<Data, Compare> tmp(other);
+  *this = std::move(tmp);
+  return *this;
+}
+
+template <typename Data, typename Compare>
+PQMinMax<Data, Compare>& PQMinMax<Data, Compare>::operator=(PQMinMax<Data, Compare>&& other) noexcept {
+  Vector<Data>::operator=(std::move(other));
+  std::swap(heapSize, other.heapSize);
+  std::swap(comp, other.comp);
+  return *this;
+}
+
+template <typename Data, typename Compare>
+bool PQMinMax<Data, Compare>::operator==(const PQMinMax<Data, Compare>& other) const noexcept {
+  if (heapSize != other.heapSize)
+                    return false;
+  PQMinMax<Data, Compare> sx(*this);
+  PQMinMax<Data, Compare> dx(other);
+  bool diffAbsence = true;
+  while (diffAbsence && !sx.Empty())
+    diffAbsence = (sx.MinNRemove() == dx.MinNRemove());
+  return diffAbsence;
+}
+
+template <typename Data, typename Compare>
+inline bool PQMinMax<Data, Compare>::operator!=(const PQMinMax<Data, Compare>& other) const noexcept {
+  return !(*this == other);
+}
+
+/* ************************************************************************** */
+
+template <typename Data, typename Compare>
+const Data& PQMinMax<Data, Compare>::Min() const {
+  if (heapSize == 0) {
+    throw std::length_error("Heap is empty");
+  }
+  return this->buffer[0];
+}
+
+template <typename Data, typename Compare>
+Data PQMinMax<Data, Compare>::MinNRemove() {
+  if (heapSize == 0) {
+    throw std::length_error("Heap is empty");
+  }
+  Data ret = std::move(this->buffer[0]);
+  RemoveMin();
+  return ret;
+}
+
+template <typename Data, typename Compare>
+void PQMinMax<Data, Compare>::RemoveMin() {
+  if (heapSize == 0) {
+    throw std::length_error("Heap is empty");
+  }
+  Data last = std::move(this->buffer[--heapSize]);
+  if (heapSize > 0)
+    TrickleDown(0, std::move(last));
+  if (size > initialSize && heapSize * 4 <= size)
+    Reallocate(size / 2);
+}
+
+template <typename Data, typename Compare>
+const Data& PQMinMax<Data, Compare>::Max() const {
+  if (heapSize == 0) {
+    throw std::length_error("Heap is empty");
+  }
+  return this->buffer[MaxIndex()];
+}
+
+template <typename Data, typename Compare>
+Data PQMinMax<Data, Compare>::MaxNRemove() {
+  if (heapSize == 0) {
+    throw std::length_error("Heap is empty");
+  }
+  Data ret = std::move(this->buffer[MaxIndex()]);
+  RemoveMax();
+  return ret;
+}
+
+template <typename Data, typename Compare>
+void PQMinMax<Data, Compare>::RemoveMax() {
+  if (heapSize == 0) {
+    throw std::length_error("Heap is empty");
+  }
+  ulong max = MaxIndex();
+  Data last = std::move(this->buffer[--heapSize]);
+  if (max < heapSize)
+    Fix(max, std::move(last));
+  if (size > initialSize && heapSize * 4 <= size)
+    Reallocate(size / 2);
+}
+
+// Checking every element against its parent and grandparent is enough: the
+// order then carries down both the min levels and the max levels.
+template <typename Data, typename Compare>
+bool PQMinMax<Data, Compare>::IsHeap() const noexcept {
+  const Data* buf = this->buffer;
+  for (ulong i = 1; i < heapSize; ++i) {
+    bool minLevel = IsMinLevel(i);
+    ulong par = parent(i);
+    if (minLevel ? comp(buf[par], buf[i]) : comp(buf[i], buf[par]))
+                                                              return false;
+    if (i < 3)
+        continue;
+    ulong grand = parent(par);
+    if (minLevel ? comp(buf[i], buf[grand]) : comp(buf[grand], buf[i]))
+                                                              return false;
+  }
+  return true;
+}
+
+/* ************************************************************************** */
+
+template <typename Data, typename Compare>
+inline const Data& PQMinMax<Data, Compare>::Tip() const {
+  return Max();
+}
+
+template <typename Data, typename Compare>
+inline void PQMinMax<Data, Compare>::RemoveTip() {
+  RemoveMax();
+}
+
+template <typename Data, typename Compare>
+inline Data PQMinMax<Data, Compare>::TipNRemove() {
+  return MaxNRemove();
+}
+
+template <typename Data, typename Compare>
+void PQMinMax<Data, Compare>::Insert(const Data& dat) {
+  Data copy = dat;
+  Insert(std::move(copy));
+}
+
+template <typename Data, typename Compare>
+void PQMinMax<Data, Compare>::Insert(Data&& dat) {
+  if (heapSize == size)
+    Reallocate(std::max(initialSize, 2 * size));
+  this->buffer[heapSize++] = std::move(dat);
+  BubbleUp(heapSize - 1);
+}
+
+template <typename Data, typename Compare>
+void PQMinMax<Data, Compare>::Change(ulong index, const Data& dat) {
+  Data copy = dat;
+  Change(index, std::move(copy));
+}
+
+template <typename Data, typename Compare>
+void PQMinMax<Data, Compare>::Change(ulong index, Data&& dat) {
+  if (index >= heapSize) {
+    throw std::out_of_range("Index out of range");
+  }
+  Fix(index, std::move(dat));
+}
+
+/* ************************************************************************** */
+
+template <typename Data, typename Compare>
+const Data& PQMinMax<Data, Compare>::operator[](ulong index) const {
+  if (index >= heapSize) {
+    throw std::out_of_range("Index out of range");
+  }
+  return this->buffer[index];
+}
+
+template <typename Data, typename Compare>
+const Data& PQMinMax<Data, Compare>::Front() const {
+  if (heapSize == 0) {
+    throw std::length_error("Heap is empty");
+  }
+  return this->buffer[0];
+}
+
+template <typename Data, typename Compare>
+const Data& PQMinMax<Data, Compare>::Back() const {
+  if (heapSize == 0) {
+    throw std::length_error("Heap is empty");
+  }
+  return this->buffer[heapSize - 1];
+}
+
+template <typename Data, typename Compare>
+void PQMinMax<Data, Compare>::Clear() noexcept {
+  Vector<Data>::Clear();
+  heapSize = 0;
+}
+
+template <typename Data, typename Compare>
+inline ulong PQMinMax<Data, Compare>::Size() const noexcept {
+  return heapSize;
+}
+
+/* ************************************************************************** */
+
+template <typename Data, typename Compare>
+void PQMinMax<Data, Compare>::Heapify() noexcept {
+  if (heapSize <= 1) return;
+  for (ulong i = parent(heapSize - 1) + 1; i > 0; --i)
+    TrickleDown(i - 1, std::move(this->buffer[i - 1]));
+}
+
+// An element beyond the bound of its nearest ancestor on the same kind of
+// level climbs that chain; one beyond its parent climbs the other chain,
+// and the parent it displaces sinks into the freed subtree in its place.
+// Otherwise the element only has to sink.
+template <typename Data, typename Compare>
+void PQMinMax<Data, Compare>::Fix(ulong index, Data dat) noexcept {
+  Data* buf = this->buffer;
+  if (index == 0) {
+    TrickleDown(0, std::move(dat));
+    return;
+  }
+  ulong par = parent(index);
+  if (IsMinLevel(index)) {
+    if (comp(buf[par], dat)) {
+      Data displaced = std::move(buf[par]);
+      BubbleUpOn<false>(par, std::move(dat));
+      TrickleDownOn<true>(index, std::move(displaced));
+    } else if (index >= 3 && comp(dat, buf[parent(par)])) {
+      BubbleUpOn<true>(index, std::move(dat));
+    } else {
+      TrickleDownOn<true>(index, std::move(dat));
+    }
+  } else {
+    if (comp(dat, buf[par])) {
+      Data displaced = std::move(buf[par]);
+      BubbleUpOn<true>(par, std::move(dat));
+      TrickleDownOn<false>(index, std::move(displaced));
+    } else if (index >= 3 && comp(buf[parent(par)], dat)) {
+      BubbleUpOn<false>(index, std::move(dat));
+    } else {
+      TrickleDownOn<false>(index, std::move(dat));
+    }
+  }
+}
+
+template <typename Data, typename Compare>
+inline void PQMinMax<Data, Compare>::TrickleDown(ulong hole, Data dat) noexcept {
+  if (IsMinLevel(hole))
+    TrickleDownOn<true>(hole, std::move(dat));
+  else
+    TrickleDownOn<false>(hole, std::move(dat));
+}
+
+// Hole-based trickle down: the best of the (up to six) children and
+// grandchildren moves into the hole. Past a grandchild, the element may have
+// to trade places with the grandchild's parent, which sits on the opposite
+// kind of level.
+template <typename Data, typename Compare>
+template <bool MinLevel>
+void PQMinMax<Data, Compare>::TrickleDownOn(ulong hole, Data moving) noexcept {
+  Data* buf = this->buffer;
+  while (left(hole) < heapSize) {
+    ulong child = left(hole);
+    ulong best = child;
+    if (child + 1 < heapSize && Beats<MinLevel>(buf[child + 1], buf[best]))
+      best = child + 1;
+    ulong grand = left(child);
+    for (ulong k = grand; k < grand + 4 && k < heapSize; ++k)
+      if (Beats<MinLevel>(buf[k], buf[best]))
+        best = k;
+    if (!Beats<MinLevel>(buf[best], moving))
+                                  break;
+    buf[hole] = std::move(buf[best]);
+    hole = best;
+    if (best < grand)
+              break;
+    ulong par = parent(best);
+    if (Beats<MinLevel>(buf[par], moving))
+      std::swap(moving, buf[par]);
+  }
+  buf[hole] = std::move(moving);
+}
+
+template <typename Data, typename Compare>
+void PQMinMax<Data, Compare>::BubbleUp(ulong hole) noexcept {
+  if (hole == 0)
+          return;
+  Data* buf = this->buffer;
+  Data moving = std::move(buf[hole]);
+  ulong par = parent(hole);
+  if (IsMinLevel(hole)) {
+    if (comp(buf[par], moving)) {
+      buf[hole] = std::move(buf[par]);
+      BubbleUpOn<false>(par, std::move(moving));
+    } else {
+      BubbleUpOn<true>(hole, std::move(moving));
+    }
+  } else {
+    if (comp(moving, buf[par])) {
+      buf[hole] = std::move(buf[par]);
+      BubbleUpOn<true>(par, std::move(moving));
+    } else {
+      BubbleUpOn<false>(hole, std::move(moving));
+    }
+  }
+}
+
+// Bubbling up only looks at grandparents: they are on the same kind of level.
+template <typename Data, typename Compare>
+template <bool MinLevel>
+void PQMinMax<Data, Compare>::BubbleUpOn(ulong hole, Data moving) noexcept {
+  Data* buf = this->buffer;
+  while (hole >= 3) {
+    ulong grand = parent(parent(hole));
+    if (!Beats<MinLevel>(moving, buf[grand]))
+                                  break;
+    buf[hole] = std::move(buf[grand]);
+    hole = grand;
+  }
+  buf[hole] = std::move(moving);
+}
+
+template <typename Data, typename Compare>
+template <bool MinLevel>
+inline bool PQMinMax<Data, Compare>::Beats(const Data& a, const Data& b) const noexcept {
+  return MinLevel ? comp(a, b) : comp(b, a);
+}
+
+template <typename Data, typename Compare>
+inline ulong PQMinMax<Data, Compare>::MaxIndex() const noexcept {
+  if (heapSize <= 2)
+          return heapSize - 1;
+  return comp(this->buffer[1], this->buffer[2]) ? 2 : 1;
+}
+
+template <typename Data, typename Compare>
+void PQMinMax<Data, Compare>::Reallocate(ulong newSize) {
+  Data* newBuffer = this->Allocate(newSize);
+  for (ulong i = 0; i < heapSize; ++i)
+    newBuffer[i] = std::move(this->buffer[i]);
+  this->Release(this->buffer, size);
+  this->buffer = newBuffer;
+  size = newSize;
+}
+
+template <typename Data, typename Compare>
+inline bool PQMinMax<Data, Compare>::IsMinLevel(ulong i) noexcept {
+  return (std::bit_width(i + 1) & 1) == 1;
+}
+
+template <typename Data, typename Compare>
+inline ulong PQMinMax<Data, Compare>::parent(ulong i) noexcept {
+  return (i - 1) / 2;
+}
+
+template <typename Data, typename Compare>
+inline ulong PQMinMax<Data, Compare>::left(ulong i) noexcept {
+  return 2 * i + 1;
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,161 @@
+
+#ifndef PQMINMAX_HPP
+#define PQMINMAX_HPP
+
+/* ************************************************************************** */
+
+#include <bit>
+
+/* ************************************************************************** */
+
+#include "../pq.hpp"
+#include "../../vector/vector.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Min-max heap: a double-ended priority queue on the same vector storage as
+// HeapVec. Levels alternate, starting from a min level at the root: an
+// element on a min level is no greater than anything below it, one on a max
+// level no smaller. The minimum is the root and the maximum one of its
+// children. The tip (as a PQ) is the maximum.
+
+template <typename Data, typename Compare = std::less<Data>>
+class PQMinMax : virtual public PQ<Data>, virtual protected SortableVector<Data, Compare> {
+  // Must extend PQ<Data>,
+  // Could extend SortableVector<Data, Compare>
+
+private:
+
+  // ...
+
+protected:
+
+  using Container::size;
+  using SortableVector<Data, Compare>::comp;
+
+  ulong heapSize = 0;
+  static const ulong initialSize;
+
+public:
+
+  // Default constructor
+  PQMinMax();
+  explicit PQMinMax(const Compare&); // An empty priority queue ordered by the given comparator
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  PQMinMax(const TraversableContainer<Data>&, const Compare& = Compare()); // A priority queue obtained from a TraversableContainer (linear time)
+  PQMinMax(MappableContainer<Data>&&, const Compare& = Compare()); // A priority queue obtained from a MappableContainer (linear time)
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  PQMinMax(const PQMinMax&);
+
+  // Move constructor
+  PQMinMax(PQMinMax&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual
+  ~PQMinMax() = default;
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  PQMinMax& operator=(const PQMinMax&);
+
+  // Move assignment
+  PQMinMax& operator=(PQMinMax&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const PQMinMax&) const noexcept; // Same elements, whatever their layout
+  bool operator!=(const PQMinMax&) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  const Data& Min() const; // (must throw std::length_error when empty)
+  Data MinNRemove(); // (must throw std::length_error when empty)
+  void RemoveMin(); // (must throw std::length_error when empty)
+
+  const Data& Max() const; // (must throw std::length_error when empty)
+  Data MaxNRemove(); // (must throw std::length_error when empty)
+  void RemoveMax(); // (must throw std::length_error when empty)
+
+  bool IsHeap() const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from PQ)
+
+  const Data& Tip() const override; // Override PQ member (the maximum; must throw std::length_error when empty)
+  void RemoveTip() override; // Override PQ member (must throw std::length_error when empty)
+  Data TipNRemove() override; // Override PQ member (must throw std::length_error when empty)
+
+  void Insert(const Data&) override; // Override PQ member (Copy of the value)
+  void Insert(Data&&) override; // Override PQ member (Move of the value)
+
+  void Change(ulong, const Data&) override; // Override PQ member (Copy of the value)
+  void Change(ulong, Data&&) override; // Override PQ member (Move of the value)
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from LinearContainer)
+
+  const Data& operator[](ulong) const override; // Override LinearContainer member (must throw std::out_of_range when out of range)
+  const Data& Front() const override; // Override LinearContainer member (must throw std::length_error when empty)
+  const Data& Back() const override; // Override LinearContainer member (must throw std::length_error when empty)
+
+  using LinearContainer<Data>::Traverse;
+  using LinearContainer<Data>::PreOrderTraverse;
+  using LinearContainer<Data>::PostOrderTraverse;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() noexcept override; // Override ClearableContainer member
+
+  ulong Size() const noexcept override;
+
+  using Container::Empty;
+
+protected:
+
+  // Auxiliary functions, if necessary!
+
+  void Heapify() noexcept;
+  void Fix(ulong, Data) noexcept; // Puts an element at the given index and restores the order around it
+  void TrickleDown(ulong, Data) noexcept;
+  template <bool MinLevel>
+  void TrickleDownOn(ulong, Data) noexcept;
+  void BubbleUp(ulong) noexcept;
+  template <bool MinLevel>
+  void BubbleUpOn(ulong, Data) noexcept;
+  template <bool MinLevel>
+  bool Beats(const Data&, const Data&) const noexcept; // Whether the first element belongs above the second on such a level
+  ulong MaxIndex() const noexcept;
+  void Reallocate(ulong);
+  static bool IsMinLevel(ulong) noexcept;
+  static ulong parent(ulong) noexcept;
+  static ulong left(ulong) noexcept;
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "pqminmax.cpp"
+
+#endif
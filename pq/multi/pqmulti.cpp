@@ -0,0 +1,132 @@
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// ...
+
+template <typename Data, ulong Arity, typename Compare>
+PQMulti<Data, Arity, Compare>::PQMulti(ulong threads, ulong factor, const Compare& comp)
+  : numShards(std::max(2UL, threads * factor)), comp(comp) {
+  shards = new Shard[numShards];
+  for (ulong i = 0; i < numShards; ++i)
+    shards[i].pq = PQHeap<Data, Arity, Compare>(comp);
+}
+
+template <typename Data, ulong Arity, typename Compare>
+PQMulti<Data, Arity, Compare>::~PQMulti() {
+  delete[] shards;
+}
+
+/* ************************************************************************** */
+
+template <typename Data, ulong Arity, typename Compare>
+void PQMulti<Data, Arity, Compare>::Insert(const Data& dat) {
+  Data copy = dat;
+  Insert(std::move(copy));
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void PQMulti<Data, Arity, Compare>::Insert(Data&& dat) {
+  while (true) {
+    Shard& shard = shards[Pick()];
+    std::unique_lock<std::mutex> guard(shard.lock, std::try_to_lock);
+    if (!guard.owns_lock())
+                  continue;
+    shard.pq.Insert(std::move(dat));
+    count.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+}
+
+// Both shards are locked, in index order, before their tips are compared.
+// After as many draws of two empty shards as there are shards, the queue is
+// probably almost empty and is scanned instead.
+template <typename Data, ulong Arity, typename Compare>
+std::optional<Data> PQMulti<Data, Arity, Compare>::TryTipNRemove() {
+  ulong empties = 0;
+  while (count.load(std::memory_order_relaxed) > 0) {
+    if (empties >= numShards)
+      return ScanNRemove();
+    ulong i = Pick(), j = Pick();
+    if (i == j)
+      j = (i + 1) % numShards;
+    if (i > j)
+      std::swap(i, j);
+    std::unique_lock<std::mutex> first(shards[i].lock, std::try_to_lock);
+    if (!first.owns_lock())
+                  continue;
+    std::unique_lock<std::mutex> second(shards[j].lock, std::try_to_lock);
+    if (!second.owns_lock())
+                  continue;
+    const Data* sx = shards[i].pq.TryTip();
+    const Data* dx = shards[j].pq.TryTip();
+    if (sx == nullptr && dx == nullptr) {
+      ++empties;
+      continue;
+    }
+    PQHeap<Data, Arity, Compare>& from = (dx == nullptr || (sx != nullptr && !comp(*sx, *dx))) ? shards[i].pq : shards[j].pq;
+    count.fetch_sub(1, std::memory_order_relaxed);
+    return from.TryTipNRemove();
+  }
+  return std::nullopt;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+Data PQMulti<Data, Arity, Compare>::TipNRemove() {
+  std::optional<Data> ret = TryTipNRemove();
+  if (!ret) {
+    throw std::length_error("Priority queue is empty");
+  }
+  return std::move(*ret);
+}
+
+template <typename Data, ulong Arity, typename Compare>
+inline ulong PQMulti<Data, Arity, Compare>::Size() const noexcept {
+  return count.load(std::memory_order_relaxed);
+}
+
+template <typename Data, ulong Arity, typename Compare>
+inline bool PQMulti<Data, Arity, Compare>::Empty() const noexcept {
+  return Size() == 0;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+inline ulong PQMulti<Data, Arity, Compare>::Shards() const noexcept {
+  return numShards;
+}
+
+/* ************************************************************************** */
+
+template <typename Data, ulong Arity, typename Compare>
+void PQMulti<Data, Arity, Compare>::Clear() noexcept {
+  for (ulong i = 0; i < numShards; ++i)
+    shards[i].pq.Clear();
+  count.store(0);
+}
+
+/* ************************************************************************** */
+
+template <typename Data, ulong Arity, typename Compare>
+std::optional<Data> PQMulti<Data, Arity, Compare>::ScanNRemove() {
+  for (ulong i = 0; i < numShards; ++i) {
+    std::lock_guard<std::mutex> guard(shards[i].lock);
+    if (!shards[i].pq.Empty()) {
+      count.fetch_sub(1, std::memory_order_relaxed);
+      return shards[i].pq.TryTipNRemove();
+    }
+  }
+  return std::nullopt;
+}
+
+// One generator per thread, seeded from its id, so that threads draw
+// different shards without sharing any state.
+template <typename Data, ulong Arity, typename Compare>
+inline ulong PQMulti<Data, Arity, Compare>::Pick() const noexcept {
+  thread_local std::minstd_rand gen(std::hash<std::thread::id>()(std::this_thread::get_id()));
+  return gen() % numShards;
+}
+
+/* ************************************************************************** */
+
+}
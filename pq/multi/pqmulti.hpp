@@ -0,0 +1,117 @@
+
+#ifndef PQMULTI_HPP
+#define PQMULTI_HPP
+
+/* ************************************************************************** */
+
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <thread>
+
+/* ************************************************************************** */
+
+#include "../heap/pqheap.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// MultiQueue: a relaxed priority queue shared by many threads, sharded into
+// several PQHeaps, each behind its own lock. Insert goes to a random shard;
+// removal looks at the tips of two random shards and takes the better one
+// (power of two choices), so the element removed is close to the tip rather
+// than the tip itself, with an expected rank error linear in the number of
+// shards. A thread finding a shard busy just picks another.
+// Not a PQ<Data>: there is no stable tip to hand out a reference to while
+// other threads are removing, nor positions to change.
+
+template <typename Data, ulong Arity = 2, typename Compare = std::less<Data>>
+class PQMulti {
+
+private:
+
+  // ...
+
+protected:
+
+  struct alignas(64) Shard {
+
+    std::mutex lock;
+    PQHeap<Data, Arity, Compare> pq;
+
+  };
+
+  Shard* shards = nullptr;
+  ulong numShards = 0;
+  std::atomic<ulong> count = 0;
+
+  [[no_unique_address]] Compare comp{};
+
+public:
+
+  // Specific constructors
+  explicit PQMulti(ulong, ulong = 2, const Compare& = Compare()); // A queue for the given number of threads, with the given number of shards per thread (at least two shards overall)
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  PQMulti(const PQMulti&) = delete; // Copy of a shared queue is not possible.
+
+  // Move constructor
+  PQMulti(PQMulti&&) = delete; // Move of a shared queue is not possible.
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual
+  ~PQMulti();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  PQMulti& operator=(const PQMulti&) = delete; // Copy assignment of a shared queue is not possible.
+
+  // Move assignment
+  PQMulti& operator=(PQMulti&&) = delete; // Move assignment of a shared queue is not possible.
+
+  /* ************************************************************************ */
+
+  // Specific member functions (safe to call concurrently)
+
+  void Insert(const Data&); // Copy of the value
+  void Insert(Data&&); // Move of the value
+
+  std::optional<Data> TryTipNRemove(); // An element near the tip; std::nullopt when every shard is empty
+  Data TipNRemove(); // An element near the tip (must throw std::length_error when empty)
+
+  ulong Size() const noexcept; // Exact when no other thread is active
+  bool Empty() const noexcept;
+
+  ulong Shards() const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (not to be called concurrently with others)
+
+  void Clear() noexcept;
+
+protected:
+
+  // Auxiliary functions, if necessary!
+
+  std::optional<Data> ScanNRemove(); // Takes the tip of the first non-empty shard
+  ulong Pick() const noexcept; // A random shard
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "pqmulti.cpp"
+
+#endif
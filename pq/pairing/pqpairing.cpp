@@ -0,0 +1,475 @@
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// ...
+
+template <typename Data, typename Compare>
+const ulong PQPairing<Data, Compare>::initialBlockSize = 16;
+
+template <typename Data, typename Compare>
+const ulong PQPairing<Data, Compare>::maxBlockSize = 4096;
+
+template <typename Data, typename Compare>
+PQPairing<Data, Compare>::PQPairing(const Compare& comp)
+  : comp(comp) {}
+
+template <typename Data, typename Compare>
+PQPairing<Data, Compare>::PQPairing(const TraversableContainer<Data>& box, const Compare& comp)
+  : PQPairing(comp) {
+  box.Traverse(
+    [this](const Data& dat)
+    {
+      Insert(dat);
+    }
+  );
+}
+
+template <typename Data, typename Compare>
+PQPairing<Data, Compare>::PQPairing(MappableContainer<Data>&& box, const Compare& comp)
+  : PQPairing(comp) {
+  box.Map(
+    [this](Data& dat)
+    {
+      Insert(std::move(dat));
+    }
+  );
+}
+
+template <typename Data, typename Compare>
+PQPairing<Data, Compare>::PQPairing(const PQPairing<Data, Compare>& other)
+  : PQPairing(other.comp) {
+  other.PreOrderTraverse(
+    [this](const Data& dat)
+    {
+      Insert(dat);
+    }
+  );
+}
+
+template <typename Data, typename Compare>
+PQPairing<Data, Compare>::PQPairing(PQPairing<Data, Compare>&& other)
+  noexcept : PQPairing(other.comp) {
+    *this = std::move(other);
+}
+
+template <typename Data, typename Compare>
+PQPairing<Data, Compare>::~PQPairing() {
+  Release();
+}
+
+template <typename Data, typename Compare>
+PQPairing<Data, Compare>& PQPairing<Data, Compare>::operator=(const PQPairing<Data, Compare>& other)
+{
+  if (this == &other) return *this;
+
+  Clear();
+  comp = other.comp;
+  other.PreOrderTraverse(
+    [this](const Data& dat)
+    {
+      Insert(dat);
+    }
+  );
+  return *this;
+}
+
+template <typename Data, typename Compare>
+PQPairing<Data, Compare>& PQPairing<Data, Compare>::operator=(PQPairing<Data, Compare>&& other)
+  noexcept {
+    std::swap(size, other.size);
+    std::swap(root, other.root);
+    std::swap(blocks, other.blocks);
+    std::swap(lastBlock, other.lastBlock);
+    std::swap(blockSize, other.blockSize);
+    std::swap(freeHead, other.freeHead);
+    std::swap(freeTail, other.freeTail);
+    std::swap(comp, other.comp);
+  return *this;
+}
+
+template <typename Data, typename Compare>
+bool PQPairing<Data, Compare>::operator==(const PQPairing<Data, Compare>& other)
+  const noexcept {
+    if (size != other.size)
+                  return false;
+    PQPairing<Data, Compare> sx(*this);
+    PQPairing<Data, Compare> dx(other);
+    bool diffAbsence = true;
+    while (diffAbsence && !sx.Empty())
+      diffAbsence = (sx.TipNRemove() == dx.TipNRemove());
+  return diffAbsence;
+}
+
+template <typename Data, typename Compare>
+inline bool PQPairing<Data, Compare>::operator!=(const PQPairing<Data, Compare>& other)
+  const noexcept {
+    return !(*this == other);
+}
+
+/* ************************************************************************** */
+
+template <typename Data, typename Compare>
+const Data& PQPairing<Data, Compare>::Tip() const {
+  if (size == 0) {
+    throw std::length_error("Priority queue is empty");
+  }
+  return root->value;
+}
+
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::RemoveTip() {
+  if (size == 0) {
+    throw std::length_error("Priority queue is empty");
+  }
+  Unlink(root);
+}
+
+template <typename Data, typename Compare>
+Data PQPairing<Data, Compare>::TipNRemove() {
+  if (size == 0) {
+    throw std::length_error("Priority queue is empty");
+  }
+  Data ret = std::move(root->value);
+  Unlink(root);
+  return ret;
+}
+
+template <typename Data, typename Compare>
+inline void PQPairing<Data, Compare>::Insert(const Data& dat) {
+  Push(dat);
+}
+
+template <typename Data, typename Compare>
+inline void PQPairing<Data, Compare>::Insert(Data&& dat) {
+  Push(std::move(dat));
+}
+
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::Change(ulong index, const Data& dat) {
+  Data copy = dat;
+  Update(At(index), std::move(copy));
+}
+
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::Change(ulong index, Data&& dat) {
+  Update(At(index), std::move(dat));
+}
+
+/* ************************************************************************** */
+
+template <typename Data, typename Compare>
+typename PQPairing<Data, Compare>::Handle PQPairing<Data, Compare>::Push(const Data& dat) {
+  Data copy = dat;
+  return Push(std::move(copy));
+}
+
+template <typename Data, typename Compare>
+typename PQPairing<Data, Compare>::Handle PQPairing<Data, Compare>::Push(Data&& dat) {
+  Node* node = Allocate(std::move(dat));
+  root = (root == nullptr) ? node : Link(root, node);
+  size++;
+  return Handle{node, node->generation};
+}
+
+template <typename Data, typename Compare>
+typename PQPairing<Data, Compare>::Handle PQPairing<Data, Compare>::TipHandle() const {
+  if (size == 0) {
+    throw std::length_error("Priority queue is empty");
+  }
+  return Handle{root, root->generation};
+}
+
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::Change(Handle hnd, const Data& dat) {
+  Data copy = dat;
+  Update(Checked(hnd), std::move(copy));
+}
+
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::Change(Handle hnd, Data&& dat) {
+  Update(Checked(hnd), std::move(dat));
+}
+
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::Remove(Handle hnd) {
+  Unlink(Checked(hnd));
+}
+
+template <typename Data, typename Compare>
+inline bool PQPairing<Data, Compare>::Contains(Handle hnd) const noexcept {
+  return hnd.node != nullptr && hnd.node->live && hnd.node->generation == hnd.generation;
+}
+
+template <typename Data, typename Compare>
+const Data& PQPairing<Data, Compare>::operator[](Handle hnd) const {
+  return Checked(hnd)->value;
+}
+
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::Meld(PQPairing<Data, Compare>&& other) noexcept {
+  if (this == &other || other.blocks == nullptr)
+                                    return;
+  if (other.root != nullptr)
+    root = (root == nullptr) ? other.root : Link(root, other.root);
+  size += other.size;
+
+  if (blocks == nullptr) {
+    blocks = other.blocks;
+    blockSize = other.blockSize;
+  } else {
+    lastBlock->next = other.blocks;
+  }
+  lastBlock = other.lastBlock;
+
+  if (freeHead == nullptr) {
+    freeHead = other.freeHead;
+  } else if (other.freeHead != nullptr) {
+    freeTail->next = other.freeHead;
+  }
+  if (other.freeTail != nullptr)
+    freeTail = other.freeTail;
+
+  other.size = 0;
+  other.root = nullptr;
+  other.blocks = other.lastBlock = nullptr;
+  other.blockSize = 0;
+  other.freeHead = other.freeTail = nullptr;
+}
+
+/* ************************************************************************** */
+
+template <typename Data, typename Compare>
+const Data& PQPairing<Data, Compare>::operator[](ulong index) const {
+  return At(index)->value;
+}
+
+// Pre-order walk over the child/sibling links, climbing back through the
+// parents instead of keeping a stack: the tree may be as deep as it is large.
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::PreOrderTraverse(TraverseFun f) const {
+  for (Node* cur = root; cur != nullptr; cur = PreOrderNext(cur))
+    f(cur->value);
+}
+
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::PostOrderTraverse(TraverseFun f) const {
+  if (size == 0)
+          return;
+  const Data** order = new const Data*[size];
+  ulong i = 0;
+  for (Node* cur = root; cur != nullptr; cur = PreOrderNext(cur))
+    order[i++] = &cur->value;
+  while (i > 0)
+    f(*order[--i]);
+  delete[] order;
+}
+
+// The nodes are freed rather than their blocks, so that their generations
+// survive and no handle taken before clearing matches a later element.
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::Clear() noexcept {
+  for (Block* block = blocks; block != nullptr; block = block->next)
+    for (ulong i = 0; i < block->count; ++i)
+      if (block->nodes[i].live)
+        Free(&block->nodes[i]);
+  size = 0;
+  root = nullptr;
+}
+
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::Release() noexcept {
+  while (blocks != nullptr) {
+    Block* next = blocks->next;
+    delete[] blocks->nodes;
+    delete blocks;
+    blocks = next;
+  }
+  size = 0;
+  root = nullptr;
+  lastBlock = nullptr;
+  blockSize = 0;
+  freeHead = freeTail = nullptr;
+}
+
+/* ************************************************************************** */
+
+// When the free list runs dry a new block is carved up, twice as large as the
+// previous one up to maxBlockSize.
+template <typename Data, typename Compare>
+typename PQPairing<Data, Compare>::Node* PQPairing<Data, Compare>::Allocate(Data&& dat) {
+  if (freeHead == nullptr) {
+    blockSize = (blockSize == 0) ? initialBlockSize : std::min(2 * blockSize, maxBlockSize);
+    Block* block = new Block;
+    block->nodes = new Node[blockSize];
+    block->count = blockSize;
+    for (ulong i = 0; i + 1 < blockSize; ++i)
+      block->nodes[i].next = &block->nodes[i + 1];
+    if (blocks == nullptr)
+      blocks = block;
+    else
+      lastBlock->next = block;
+    lastBlock = block;
+    freeHead = block->nodes;
+    freeTail = &block->nodes[blockSize - 1];
+  }
+  Node* node = freeHead;
+  freeHead = node->next;
+  if (freeHead == nullptr)
+    freeTail = nullptr;
+  node->value = std::move(dat);
+  node->child = node->next = node->prev = nullptr;
+  node->live = true;
+  return node;
+}
+
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::Free(Node* node) noexcept {
+  node->value = Data();
+  node->live = false;
+  ++node->generation;
+  node->child = node->prev = nullptr;
+  node->next = freeHead;
+  freeHead = node;
+  if (freeTail == nullptr)
+    freeTail = node;
+}
+
+// Makes the lesser of two roots the leftmost child of the other.
+template <typename Data, typename Compare>
+typename PQPairing<Data, Compare>::Node* PQPairing<Data, Compare>::Link(Node* a, Node* b) noexcept {
+  if (comp(a->value, b->value))
+    std::swap(a, b);
+  b->prev = a;
+  b->next = a->child;
+  if (a->child != nullptr)
+    a->child->prev = b;
+  a->child = b;
+  a->next = a->prev = nullptr;
+  return a;
+}
+
+// Two-pass pairing of a sibling list: adjacent trees are linked left to
+// right, the winners are stacked, then folded into one tree right to left.
+template <typename Data, typename Compare>
+typename PQPairing<Data, Compare>::Node* PQPairing<Data, Compare>::MergePairs(Node* first) noexcept {
+  if (first == nullptr)
+            return nullptr;
+  Node* paired = nullptr;
+  while (first != nullptr) {
+    Node* a = first;
+    Node* b = a->next;
+    if (b == nullptr) {
+      a->prev = nullptr;
+      a->next = paired;
+      paired = a;
+      break;
+    }
+    first = b->next;
+    Node* win = Link(a, b);
+    win->next = paired;
+    paired = win;
+  }
+  Node* tree = paired;
+  paired = paired->next;
+  tree->next = nullptr;
+  while (paired != nullptr) {
+    Node* next = paired->next;
+    tree = Link(tree, paired);
+    paired = next;
+  }
+  return tree;
+}
+
+// Cuts the subtree rooted at a non-root node out of its sibling list.
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::Detach(Node* node) noexcept {
+  if (node->prev->child == node)
+    node->prev->child = node->next;
+  else
+    node->prev->next = node->next;
+  if (node->next != nullptr)
+    node->next->prev = node->prev;
+  node->next = node->prev = nullptr;
+}
+
+// Removes one element: its children are paired into a single tree, which
+// takes its place (as the new root) or is linked back under the root.
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::Unlink(Node* node) noexcept {
+  Node* sub = MergePairs(node->child);
+  node->child = nullptr;
+  if (node == root) {
+    root = sub;
+  } else {
+    Detach(node);
+    if (sub != nullptr)
+      root = Link(root, sub);
+  }
+  Free(node);
+  size--;
+}
+
+// Raising an element only cuts its subtree and links it under the root;
+// lowering it must also let its former children compete again.
+template <typename Data, typename Compare>
+void PQPairing<Data, Compare>::Update(Node* node, Data&& dat) noexcept {
+  bool up = comp(node->value, dat);
+  node->value = std::move(dat);
+  if (up) {
+    if (node != root) {
+      Detach(node);
+      root = Link(root, node);
+    }
+    return;
+  }
+  Node* sub = MergePairs(node->child);
+  node->child = nullptr;
+  if (sub == nullptr)
+            return;
+  if (node == root) {
+    root = Link(node, sub);
+  } else {
+    root = Link(root, sub);
+  }
+}
+
+template <typename Data, typename Compare>
+inline typename PQPairing<Data, Compare>::Node* PQPairing<Data, Compare>::Checked(Handle hnd) const {
+  if (!Contains(hnd)) {
+    throw std::out_of_range("Handle not in the priority queue");
+  }
+  return hnd.node;
+}
+
+template <typename Data, typename Compare>
+typename PQPairing<Data, Compare>::Node* PQPairing<Data, Compare>::At(ulong index) const {
+  if (index >= size) {
+    throw std::out_of_range("Index out of range");
+  }
+  Node* cur = root;
+  while (index-- > 0)
+    cur = PreOrderNext(cur);
+  return cur;
+}
+
+template <typename Data, typename Compare>
+typename PQPairing<Data, Compare>::Node* PQPairing<Data, Compare>::Parent(Node* node) noexcept {
+  while (node->prev != nullptr && node->prev->child != node)
+    node = node->prev;
+  return node->prev;
+}
+
+template <typename Data, typename Compare>
+typename PQPairing<Data, Compare>::Node* PQPairing<Data, Compare>::PreOrderNext(Node* node) noexcept {
+  if (node->child != nullptr)
+              return node->child;
+  while (node != nullptr && node->next == nullptr)
+    node = Parent(node);
+  return (node == nullptr) ? nullptr : node->next;
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,199 @@
+
+#ifndef PQPAIRING_HPP
+#define PQPAIRING_HPP
+
+/* ************************************************************************** */
+
+#include "../pq.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Pairing heap: a heap-ordered multiway tree kept as leftmost-child /
+// right-sibling links. Insert, Meld and raising an element towards the tip
+// are O(1); removing the tip pairs up its children left to right and then
+// folds the pairs right to left, in O(log n) amortized. Nodes come from
+// blocks owned by the queue and are recycled through a free list, so that
+// Meld can splice the blocks of the other queue in O(1) as well.
+// Handles name a node and its generation: they stay valid across Meld and
+// until their element leaves the queue, after which the recycled node no
+// longer matches them.
+// Clear and copy assignment keep the blocks, so a stale handle can be tested
+// for as long as the queue lives.
+
+template <typename Data, typename Compare = std::less<Data>>
+class PQPairing : virtual public PQ<Data> {
+  // Must extend PQ<Data>
+
+private:
+
+  // ...
+
+protected:
+
+  using Container::size;
+
+  struct Node {
+
+    Data value;
+    Node* child = nullptr; // Leftmost child
+    Node* next = nullptr; // Right sibling (next free node when unused)
+    Node* prev = nullptr; // Left sibling, or parent for a leftmost child
+    bool live = false;
+    ulong generation = 0; // Bumped whenever the node is freed
+
+  };
+
+  struct Block {
+
+    Node* nodes = nullptr;
+    ulong count = 0;
+    Block* next = nullptr;
+
+  };
+
+  static const ulong initialBlockSize;
+  static const ulong maxBlockSize;
+
+  Node* root = nullptr;
+  Block* blocks = nullptr;
+  Block* lastBlock = nullptr;
+  ulong blockSize = 0; // Nodes in the most recent block
+  Node* freeHead = nullptr;
+  Node* freeTail = nullptr;
+
+  [[no_unique_address]] Compare comp{};
+
+public:
+
+  struct Handle {
+
+    Node* node;
+    ulong generation;
+
+    bool operator==(const Handle&) const noexcept = default;
+
+  };
+
+  // Default constructor
+  PQPairing() = default;
+  explicit PQPairing(const Compare&); // An empty priority queue ordered by the given comparator
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  PQPairing(const TraversableContainer<Data>&, const Compare& = Compare()); // A priority queue obtained from a TraversableContainer
+  PQPairing(MappableContainer<Data>&&, const Compare& = Compare()); // A priority queue obtained from a MappableContainer
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  PQPairing(const PQPairing&);
+
+  // Move constructor
+  PQPairing(PQPairing&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual
+  ~PQPairing();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  PQPairing& operator=(const PQPairing&);
+
+  // Move assignment
+  PQPairing& operator=(PQPairing&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const PQPairing&) const noexcept; // Same elements, whatever their tree shape
+  bool operator!=(const PQPairing&) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from PQ)
+
+  const Data& Tip() const override; // Override PQ member (must throw std::length_error when empty)
+  void RemoveTip() override; // Override PQ member (must throw std::length_error when empty)
+  Data TipNRemove() override; // Override PQ member (must throw std::length_error when empty)
+
+  void Insert(const Data&) override; // Override PQ member (Copy of the value)
+  void Insert(Data&&) override; // Override PQ member (Move of the value)
+
+  void Change(ulong, const Data&) override; // Override PQ member (Copy of the value; the index is in pre-order, located in O(index))
+  void Change(ulong, Data&&) override; // Override PQ member (Move of the value; the index is in pre-order, located in O(index))
+
+  /* ************************************************************************ */
+
+  // Specific member functions (addressing by handle)
+
+  Handle Push(const Data&); // Copy of the value
+  Handle Push(Data&&); // Move of the value
+
+  Handle TipHandle() const; // (must throw std::length_error when empty)
+
+  void Change(Handle, const Data&); // Copy of the value (must throw std::out_of_range when not in the queue)
+  void Change(Handle, Data&&); // Move of the value (must throw std::out_of_range when not in the queue)
+
+  void Remove(Handle); // (must throw std::out_of_range when not in the queue)
+
+  bool Contains(Handle) const noexcept;
+
+  const Data& operator[](Handle) const; // (must throw std::out_of_range when not in the queue)
+
+  void Meld(PQPairing&&) noexcept; // Moves every element of the other queue here, leaving it empty
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from LinearContainer)
+
+  const Data& operator[](ulong) const override; // Override LinearContainer member (pre-order, located in O(index); must throw std::out_of_range when out of range)
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from PreOrderTraversableContainer and PostOrderTraversableContainer)
+
+  using typename TraversableContainer<Data>::TraverseFun;
+
+  void PreOrderTraverse(TraverseFun) const override; // Override LinearContainer member
+  void PostOrderTraverse(TraverseFun) const override; // Override LinearContainer member
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() noexcept override; // Override ClearableContainer member
+
+protected:
+
+  // Auxiliary functions, if necessary!
+
+  Node* Allocate(Data&&);
+  void Free(Node*) noexcept;
+  void Release() noexcept; // Gives the blocks back
+  Node* Link(Node*, Node*) noexcept;
+  Node* MergePairs(Node*) noexcept;
+  void Detach(Node*) noexcept;
+  void Unlink(Node*) noexcept;
+  void Update(Node*, Data&&) noexcept;
+  Node* Checked(Handle) const;
+  Node* At(ulong) const;
+  static Node* Parent(Node*) noexcept;
+  static Node* PreOrderNext(Node*) noexcept;
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "pqpairing.cpp"
+
+#endif
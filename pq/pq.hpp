@@ -4,6 +4,10 @@
 
 /* ************************************************************************** */
 
+#include <optional>
+
+/* ************************************************************************** */
+
 #include "../container/linear.hpp"
 
 /* ************************************************************************** */
@@ -56,6 +60,24 @@ public:
   virtual
   void Change(ulong, Data&&) = 0; // Move of the value
 
+  // Non-throwing counterparts of Tip and TipNRemove: an empty queue yields nullptr/std::nullopt
+
+  virtual
+  const Data* TryTip() const noexcept
+  {
+    if (this->Size() == 0)
+                return nullptr;
+    return &Tip();
+  }
+
+  virtual
+  std::optional<Data> TryTipNRemove()
+  {
+    if (this->Size() == 0)
+                return std::nullopt;
+    return TipNRemove();
+  }
+
 };
 
 /* ************************************************************************** */
@@ -0,0 +1,276 @@
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// ...
+
+template <typename Data, typename KeyOf>
+const ulong PQRadix<Data, KeyOf>::initialBucketSize = 4;
+
+template <typename Data, typename KeyOf>
+PQRadix<Data, KeyOf>::PQRadix() {
+  size = 0;
+}
+
+template <typename Data, typename KeyOf>
+PQRadix<Data, KeyOf>::PQRadix(const KeyOf& keyOf)
+  : PQRadix() {
+  this->keyOf = keyOf;
+}
+
+template <typename Data, typename KeyOf>
+PQRadix<Data, KeyOf>::PQRadix(const TraversableContainer<Data>& box, const KeyOf& keyOf)
+  : PQRadix(keyOf) {
+  box.Traverse(
+    [this](const Data& dat)
+    {
+      Insert(dat);
+    }
+  );
+}
+
+template <typename Data, typename KeyOf>
+PQRadix<Data, KeyOf>::PQRadix(MappableContainer<Data>&& box, const KeyOf& keyOf)
+  : PQRadix(keyOf) {
+  box.Map(
+    [this](Data& dat)
+    {
+      Insert(std::move(dat));
+    }
+  );
+}
+
+template <typename Data, typename KeyOf>
+PQRadix<Data, KeyOf>::PQRadix(const PQRadix<Data, KeyOf>& other)
+  : last(other.last), tipKnown(other.tipKnown), tipBucket(other.tipBucket),
+    tipIndex(other.tipIndex), keyOf(other.keyOf) {
+  size = other.size;
+  for (ulong b = 0; b < numBuckets; ++b) {
+    bucket[b] = other.bucket[b];
+    count[b] = other.count[b];
+  }
+}
+
+template <typename Data, typename KeyOf>
+PQRadix<Data, KeyOf>::PQRadix(PQRadix<Data, KeyOf>&& other)
+  noexcept : keyOf(other.keyOf) {
+    size = 0;
+    *this = std::move(other);
+}
+
+template <typename Data, typename KeyOf>
+PQRadix<Data, KeyOf>& PQRadix<Data, KeyOf>::operator=(const PQRadix<Data, KeyOf>& other)
+{
+  if (this == &other) return *this;
+
+  PQRadix<Data, KeyOf> tmp(other);
+  *this = std::move(tmp);
+  return *this;
+}
+
+template <typename Data, typename KeyOf>
+PQRadix<Data, KeyOf>& PQRadix<Data, KeyOf>::operator=(PQRadix<Data, KeyOf>&& other)
+  noexcept {
+    std::swap(size, other.size);
+    for (ulong b = 0; b < numBuckets; ++b) {
+      std::swap(bucket[b], other.bucket[b]);
+      std::swap(count[b], other.count[b]);
+    }
+    std::swap(last, other.last);
+    std::swap(tipKnown, other.tipKnown);
+    std::swap(tipBucket, other.tipBucket);
+    std::swap(tipIndex, other.tipIndex);
+    std::swap(keyOf, other.keyOf);
+  return *this;
+}
+
+template <typename Data, typename KeyOf>
+bool PQRadix<Data, KeyOf>::operator==(const PQRadix<Data, KeyOf>& other)
+  const noexcept {
+    if (size != other.size)
+                  return false;
+    PQRadix<Data, KeyOf> sx(*this);
+    PQRadix<Data, KeyOf> dx(other);
+    bool diffAbsence = true;
+    while (diffAbsence && !sx.Empty())
+      diffAbsence = (sx.TipNRemove() == dx.TipNRemove());
+  return diffAbsence;
+}
+
+template <typename Data, typename KeyOf>
+inline bool PQRadix<Data, KeyOf>::operator!=(const PQRadix<Data, KeyOf>& other)
+  const noexcept {
+    return !(*this == other);
+}
+
+/* ************************************************************************** */
+
+// Looking at the tip does not move anything: with bucket 0 empty, the smallest
+// element of the first non-empty bucket is searched for once and remembered
+// until the next removal, which spreads that bucket anyway.
+template <typename Data, typename KeyOf>
+const Data& PQRadix<Data, KeyOf>::Tip() const {
+  if (size == 0) {
+    throw std::length_error("Priority queue is empty");
+  }
+  if (count[0] > 0)
+    return bucket[0][count[0] - 1];
+  FindTip();
+  return bucket[tipBucket][tipIndex];
+}
+
+template <typename Data, typename KeyOf>
+void PQRadix<Data, KeyOf>::RemoveTip() {
+  if (size == 0) {
+    throw std::length_error("Priority queue is empty");
+  }
+  Redistribute();
+  bucket[0][--count[0]] = Data();
+  --size;
+}
+
+template <typename Data, typename KeyOf>
+Data PQRadix<Data, KeyOf>::TipNRemove() {
+  if (size == 0) {
+    throw std::length_error("Priority queue is empty");
+  }
+  Redistribute();
+  Data ret = std::move(bucket[0][--count[0]]);
+  bucket[0][count[0]] = Data();
+  --size;
+  return ret;
+}
+
+template <typename Data, typename KeyOf>
+void PQRadix<Data, KeyOf>::Insert(const Data& dat) {
+  Data copy = dat;
+  Insert(std::move(copy));
+}
+
+template <typename Data, typename KeyOf>
+void PQRadix<Data, KeyOf>::Insert(Data&& dat) {
+  ulong b = Admit(dat);
+  // Bucket 0 is served before any cached tip, which only ever refers to a
+  // higher bucket
+  if (tipKnown && b > 0 && (b < tipBucket || (b == tipBucket && keyOf(dat) < keyOf(bucket[tipBucket][tipIndex])))) {
+    tipBucket = b;
+    tipIndex = count[b];
+  }
+  Append(b, std::move(dat));
+  ++size;
+}
+
+template <typename Data, typename KeyOf>
+void PQRadix<Data, KeyOf>::Change(ulong index, const Data& dat) {
+  Data copy = dat;
+  Change(index, std::move(copy));
+}
+
+// The old element leaves its bucket, the last one of the bucket filling its
+// place, and the new one is inserted as usual.
+template <typename Data, typename KeyOf>
+void PQRadix<Data, KeyOf>::Change(ulong index, Data&& dat) {
+  ulong b, i;
+  Locate(index, b, i);
+  ulong to = Admit(dat);
+  bucket[b][i] = std::move(bucket[b][--count[b]]);
+  bucket[b][count[b]] = Data();
+  tipKnown = false;
+  Append(to, std::move(dat));
+}
+
+/* ************************************************************************** */
+
+template <typename Data, typename KeyOf>
+inline ulong PQRadix<Data, KeyOf>::LastKey() const noexcept {
+  return last;
+}
+
+/* ************************************************************************** */
+
+template <typename Data, typename KeyOf>
+const Data& PQRadix<Data, KeyOf>::operator[](ulong index) const {
+  ulong b, i;
+  Locate(index, b, i);
+  return bucket[b][i];
+}
+
+template <typename Data, typename KeyOf>
+void PQRadix<Data, KeyOf>::Clear() noexcept {
+  PQRadix<Data, KeyOf> empty(keyOf);
+  *this = std::move(empty);
+}
+
+/* ************************************************************************** */
+
+template <typename Data, typename KeyOf>
+ulong PQRadix<Data, KeyOf>::Admit(const Data& dat) const {
+  ulong key = keyOf(dat);
+  if (key < last) {
+    throw std::invalid_argument("Key below the last one removed");
+  }
+  return BucketOf(key);
+}
+
+template <typename Data, typename KeyOf>
+inline ulong PQRadix<Data, KeyOf>::BucketOf(ulong key) const noexcept {
+  return std::bit_width(key ^ last);
+}
+
+template <typename Data, typename KeyOf>
+void PQRadix<Data, KeyOf>::Append(ulong b, Data&& dat) {
+  if (count[b] == bucket[b].Size())
+    bucket[b].Resize(std::max(initialBucketSize, 2 * count[b]));
+  Data* buf = &bucket[b][0];
+  buf[count[b]++] = std::move(dat);
+}
+
+template <typename Data, typename KeyOf>
+void PQRadix<Data, KeyOf>::FindTip() const noexcept {
+  if (tipKnown)
+          return;
+  ulong b = 1;
+  while (count[b] == 0)
+    ++b;
+  const Data* buf = &bucket[b][0];
+  ulong min = 0;
+  for (ulong i = 1; i < count[b]; ++i)
+    if (keyOf(buf[i]) < keyOf(buf[min]))
+      min = i;
+  tipBucket = b;
+  tipIndex = min;
+  tipKnown = true;
+}
+
+// Keys in bucket b share with the last key every bit above b - 1 and differ
+// in bit b - 1; once the smallest of them becomes the last key, each of them
+// differs from it in a lower bit only, so it lands in a lower bucket.
+template <typename Data, typename KeyOf>
+void PQRadix<Data, KeyOf>::Redistribute() {
+  if (count[0] > 0)
+          return;
+  FindTip();
+  ulong b = tipBucket;
+  Data* buf = &bucket[b][0];
+  last = keyOf(buf[tipIndex]);
+  for (ulong i = 0; i < count[b]; ++i)
+    Append(BucketOf(keyOf(buf[i])), std::move(buf[i]));
+  count[b] = 0;
+  tipKnown = false;
+}
+
+template <typename Data, typename KeyOf>
+void PQRadix<Data, KeyOf>::Locate(ulong index, ulong& b, ulong& i) const {
+  if (index >= size) {
+    throw std::out_of_range("Index out of range");
+  }
+  b = 0;
+  while (index >= count[b])
+    index -= count[b++];
+  i = index;
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,160 @@
+
+#ifndef PQRADIX_HPP
+#define PQRADIX_HPP
+
+/* ************************************************************************** */
+
+#include <bit>
+#include <type_traits>
+
+/* ************************************************************************** */
+
+#include "../pq.hpp"
+#include "../../vector/vector.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Default key extractor: the element itself, for unsigned integral types.
+template <typename Data>
+struct RadixKey {
+
+  static_assert(std::is_integral_v<Data> && std::is_unsigned_v<Data>, "PQRadix needs unsigned integral elements or a key extractor");
+
+  ulong operator()(const Data& dat) const noexcept { return static_cast<ulong>(dat); }
+
+};
+
+/* ************************************************************************** */
+
+// Radix heap: a monotone min-priority queue over unsigned integer keys. The
+// key of every element inserted must be no smaller than that of the last
+// element removed (std::invalid_argument otherwise). Elements are kept in
+// buckets by the highest bit in which their key differs from that last key:
+// bucket 0 holds ties with it. Removing from an empty bucket 0 takes the
+// first non-empty bucket, whose minimum becomes the new last key, and spreads
+// it over lower buckets; each element can only move down, hence amortized
+// O(log C) per operation for keys spanning a range of C. The tip is the
+// element with the smallest key.
+
+template <typename Data, typename KeyOf = RadixKey<Data>>
+class PQRadix : virtual public PQ<Data> {
+  // Must extend PQ<Data>
+
+private:
+
+  // ...
+
+protected:
+
+  using Container::size;
+
+  static const ulong numBuckets = 65; // One per possible highest differing bit, plus ties
+  static const ulong initialBucketSize;
+
+  Vector<Data> bucket[numBuckets];
+  ulong count[numBuckets] = {};
+  ulong last = 0; // Key of the last element removed
+
+  // Where the tip is, when bucket 0 is empty and it has already been looked for
+  mutable bool tipKnown = false;
+  mutable ulong tipBucket = 0;
+  mutable ulong tipIndex = 0;
+
+  [[no_unique_address]] KeyOf keyOf{};
+
+public:
+
+  // Default constructor
+  PQRadix();
+  explicit PQRadix(const KeyOf&); // An empty priority queue using the given key extractor
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  PQRadix(const TraversableContainer<Data>&, const KeyOf& = KeyOf()); // A priority queue obtained from a TraversableContainer
+  PQRadix(MappableContainer<Data>&&, const KeyOf& = KeyOf()); // A priority queue obtained from a MappableContainer
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  PQRadix(const PQRadix&);
+
+  // Move constructor
+  PQRadix(PQRadix&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual
+  ~PQRadix() = default;
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  PQRadix& operator=(const PQRadix&);
+
+  // Move assignment
+  PQRadix& operator=(PQRadix&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const PQRadix&) const noexcept; // Same sequence of removals, whatever their buckets
+  bool operator!=(const PQRadix&) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from PQ)
+
+  const Data& Tip() const override; // Override PQ member (must throw std::length_error when empty)
+  void RemoveTip() override; // Override PQ member (must throw std::length_error when empty)
+  Data TipNRemove() override; // Override PQ member (must throw std::length_error when empty)
+
+  void Insert(const Data&) override; // Override PQ member (Copy of the value; must throw std::invalid_argument when below the last key removed)
+  void Insert(Data&&) override; // Override PQ member (Move of the value; must throw std::invalid_argument when below the last key removed)
+
+  void Change(ulong, const Data&) override; // Override PQ member (Copy of the value; must throw std::invalid_argument when below the last key removed)
+  void Change(ulong, Data&&) override; // Override PQ member (Move of the value; must throw std::invalid_argument when below the last key removed)
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  ulong LastKey() const noexcept; // Lower bound for the keys that may be inserted
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from LinearContainer)
+
+  const Data& operator[](ulong) const override; // Override LinearContainer member (bucket by bucket; must throw std::out_of_range when out of range)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() noexcept override; // Override ClearableContainer member
+
+protected:
+
+  // Auxiliary functions, if necessary!
+
+  ulong Admit(const Data&) const; // Bucket of an element about to be inserted (must throw std::invalid_argument when below the last key removed)
+  ulong BucketOf(ulong) const noexcept;
+  void Append(ulong, Data&&);
+  void FindTip() const noexcept;
+  void Redistribute();
+  void Locate(ulong, ulong&, ulong&) const; // Bucket and index of a position (must throw std::out_of_range when out of range)
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "pqradix.cpp"
+
+#endif
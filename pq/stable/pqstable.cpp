@@ -0,0 +1,294 @@
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// ...
+
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+const ulong PQStable<Data, Arity, Compare, Seq>::initialSize = 16;
+
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+PQStable<Data, Arity, Compare, Seq>::PQStable()
+  : values(initialSize), arrival(initialSize) {
+  size = 0;
+}
+
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+PQStable<Data, Arity, Compare, Seq>::PQStable(const Compare& comp)
+  : PQStable() {
+  this->comp = comp;
+}
+
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+PQStable<Data, Arity, Compare, Seq>::PQStable(const TraversableContainer<Data>& box, const Compare& comp)
+  : PQStable(comp) {
+  Reserve(box.Size());
+  box.Traverse(
+    [this](const Data& dat)
+    {
+      arrival[size] = Arrive();
+      values[size++] = dat;
+    }
+  );
+  Heapify();
+}
+
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+PQStable<Data, Arity, Compare, Seq>::PQStable(MappableContainer<Data>&& box, const Compare& comp)
+  : PQStable(comp) {
+  Reserve(box.Size());
+  box.Map(
+    [this](Data& dat)
+    {
+      arrival[size] = Arrive();
+      values[size++] = std::move(dat);
+    }
+  );
+  Heapify();
+}
+
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+PQStable<Data, Arity, Compare, Seq>::PQStable(const PQStable<Data, Arity, Compare, Seq>& other)
+  : values(other.values), arrival(other.arrival), next(other.next), comp(other.comp) {
+  size = other.size;
+}
+
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+PQStable<Data, Arity, Compare, Seq>::PQStable(PQStable<Data, Arity, Compare, Seq>&& other)
+  noexcept : comp(other.comp) {
+    size = 0;
+    *this = std::move(other);
+}
+
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+PQStable<Data, Arity, Compare, Seq>& PQStable<Data, Arity, Compare, Seq>::operator=(const PQStable<Data, Arity, Compare, Seq>& other)
+{
+  if (this == &other) return *this;
+
+  PQStable<Data, Arity, Compare, Seq> tmp(other);
+  *this = std::move(tmp);
+  return *this;
+}
+
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+PQStable<Data, Arity, Compare, Seq>& PQStable<Data, Arity, Compare, Seq>::operator=(PQStable<Data, Arity, Compare, Seq>&& other)
+  noexcept {
+    std::swap(size, other.size);
+    std::swap(values, other.values);
+    std::swap(arrival, other.arrival);
+    std::swap(next, other.next);
+    std::swap(comp, other.comp);
+  return *this;
+}
+
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+bool PQStable<Data, Arity, Compare, Seq>::operator==(const PQStable<Data, Arity, Compare, Seq>& other)
+  const noexcept {
+    if (size != other.size)
+                  return false;
+    PQStable<Data, Arity, Compare, Seq> sx(*this);
+    PQStable<Data, Arity, Compare, Seq> dx(other);
+    bool diffAbsence = true;
+    while (diffAbsence && !sx.Empty())
+      diffAbsence = (sx.TipNRemove() == dx.TipNRemove());
+  return diffAbsence;
+}
+
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+inline bool PQStable<Data, Arity, Compare, Seq>::operator!=(const PQStable<Data, Arity, Compare, Seq>& other)
+  const noexcept {
+    return !(*this == other);
+}
+
+/* ************************************************************************** */
+
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+const Data& PQStable<Data, Arity, Compare, Seq>::Tip() const {
+  if (size == 0) {
+    throw std::length_error("Priority queue is empty");
+  }
+  return values[0];
+}
+
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+void PQStable<Data, Arity, Compare, Seq>::RemoveTip() {
+  if (size == 0) {
+    throw std::length_error("Priority queue is empty");
+  }
+  Erase(0);
+}
+
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+Data PQStable<Data, Arity, Compare, Seq>::TipNRemove() {
+  if (size == 0) {
+    throw std::length_error("Priority queue is empty");
+  }
+  Data ret = std::move(values[0]);
+  Erase(0);
+  return ret;
+}
+
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+void PQStable<Data, Arity, Compare, Seq>::Insert(const Data& dat) {
+  Data copy = dat;
+  Insert(std::move(copy));
+}
+
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+void PQStable<Data, Arity, Compare, Seq>::Insert(Data&& dat) {
+  if (size == values.Size())
+    Reserve(std::max(initialSize, 2 * values.Size()));
+  Seq seq = Arrive();
+  SiftUp(size++, std::move(dat), seq);
+}
+
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+void PQStable<Data, Arity, Compare, Seq>::Change(ulong index, const Data& dat) {
+  Data copy = dat;
+  Change(index, std::move(copy));
+}
+
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+void PQStable<Data, Arity, Compare, Seq>::Change(ulong index, Data&& dat) {
+  if (index >= size) {
+    throw std::out_of_range("Index out of range");
+  }
+  Seq seq = arrival[index];
+  if (comp(values[index], dat))
+    SiftUp(index, std::move(dat), seq);
+  else
+    SiftDown(index, std::move(dat), seq);
+}
+
+/* ************************************************************************** */
+
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+void PQStable<Data, Arity, Compare, Seq>::Reserve(ulong dim) {
+  if (dim <= values.Size())
+                    return;
+  values.Resize(dim);
+  arrival.Resize(dim);
+}
+
+/* ************************************************************************** */
+
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+const Data& PQStable<Data, Arity, Compare, Seq>::operator[](ulong index) const {
+  if (index >= size) {
+    throw std::out_of_range("Index out of range");
+  }
+  return values[index];
+}
+
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+void PQStable<Data, Arity, Compare, Seq>::Clear() noexcept {
+  PQStable<Data, Arity, Compare, Seq> empty(comp);
+  *this = std::move(empty);
+}
+
+/* ************************************************************************** */
+
+// The arrival numbers are compared only when neither element is greater.
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+inline bool PQStable<Data, Arity, Compare, Seq>::Beats(const Data& sx, Seq sxSeq, const Data& dx, Seq dxSeq) const noexcept {
+  if (comp(dx, sx))
+        return true;
+  return !comp(sx, dx) && sxSeq < dxSeq;
+}
+
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+inline Seq PQStable<Data, Arity, Compare, Seq>::Arrive() {
+  if (next == std::numeric_limits<Seq>::max())
+    Renumber();
+  return next++;
+}
+
+// Arrival numbers are replaced by their ranks among the queued elements; the
+// heap order is unaffected, as the relative order of every pair is kept.
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+void PQStable<Data, Arity, Compare, Seq>::Renumber() {
+  Vector<ulong> byArrival(size);
+  for (ulong i = 0; i < size; ++i)
+    byArrival[i] = i;
+  if (size > 0) {
+    const Seq* seqs = &arrival[0];
+    std::sort(&byArrival[0], &byArrival[0] + size, [seqs](ulong sx, ulong dx) { return seqs[sx] < seqs[dx]; });
+  }
+  for (ulong r = 0; r < size; ++r)
+    arrival[byArrival[r]] = static_cast<Seq>(r);
+  next = static_cast<Seq>(size);
+}
+
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+void PQStable<Data, Arity, Compare, Seq>::Erase(ulong index) noexcept {
+  if (index == --size) {
+    values[size] = Data();
+    return;
+  }
+  Data moving = std::move(values[size]);
+  values[size] = Data();
+  if (index > 0 && Beats(moving, arrival[size], values[parent(index)], arrival[parent(index)]))
+    SiftUp(index, std::move(moving), arrival[size]);
+  else
+    SiftDown(index, std::move(moving), arrival[size]);
+}
+
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+void PQStable<Data, Arity, Compare, Seq>::Heapify() noexcept {
+  if (size <= 1) return;
+  for (ulong i = parent(size - 1) + 1; i > 0; --i)
+    SiftDown(i - 1, std::move(values[i - 1]), arrival[i - 1]);
+}
+
+// Hole-based sifting as in PQHeap, with the arrival number travelling along
+// with each element in its own lane.
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+void PQStable<Data, Arity, Compare, Seq>::SiftUp(ulong hole, Data moving, Seq seq) noexcept {
+  Data* buf = &values[0];
+  Seq* seqs = &arrival[0];
+  while (hole > 0) {
+    ulong par = parent(hole);
+    if (!Beats(moving, seq, buf[par], seqs[par]))
+                        break;
+    buf[hole] = std::move(buf[par]);
+    seqs[hole] = seqs[par];
+    hole = par;
+  }
+  buf[hole] = std::move(moving);
+  seqs[hole] = seq;
+}
+
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+void PQStable<Data, Arity, Compare, Seq>::SiftDown(ulong hole, Data moving, Seq seq) noexcept {
+  Data* buf = &values[0];
+  Seq* seqs = &arrival[0];
+  while (left(hole) < size) {
+    ulong first = left(hole);
+    ulong last = std::min(first + Arity, size);
+    ulong max = first;
+    for (ulong c = first + 1; c < last; ++c)
+      max = Beats(buf[c], seqs[c], buf[max], seqs[max]) ? c : max;
+    if (!Beats(buf[max], seqs[max], moving, seq))
+                        break;
+    buf[hole] = std::move(buf[max]);
+    seqs[hole] = seqs[max];
+    hole = max;
+  }
+  buf[hole] = std::move(moving);
+  seqs[hole] = seq;
+}
+
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+inline ulong PQStable<Data, Arity, Compare, Seq>::parent(ulong i) noexcept {
+  return (i - 1) / Arity;
+}
+
+template <typename Data, ulong Arity, typename Compare, typename Seq>
+inline ulong PQStable<Data, Arity, Compare, Seq>::left(ulong i) noexcept {
+  return Arity * i + 1;
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,147 @@
+
+#ifndef PQSTABLE_HPP
+#define PQSTABLE_HPP
+
+/* ************************************************************************** */
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+/* ************************************************************************** */
+
+#include "../pq.hpp"
+#include "../../vector/vector.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Stable priority queue: among elements equal under Compare, the one inserted
+// first leaves first. Every element gets an arrival number from a counter,
+// kept in a lane of the heap parallel to the elements rather than inside
+// them, and consulted only on ties. The counter is narrow (32 bits by
+// default); when it runs out, the queued elements are renumbered from zero in
+// arrival order, which takes O(n log n) once every 2^32 - n insertions. The
+// counter must be able to number more elements than are ever queued at once.
+
+template <typename Data, ulong Arity = 2, typename Compare = std::less<Data>, typename Seq = std::uint32_t>
+class PQStable : virtual public PQ<Data> {
+  // Must extend PQ<Data>
+
+  static_assert(Arity >= 2 && (Arity & (Arity - 1)) == 0, "Arity must be a power of two");
+  static_assert(std::is_unsigned_v<Seq>, "Arrival numbers must be unsigned");
+
+private:
+
+  // ...
+
+protected:
+
+  using Container::size;
+
+  static const ulong initialSize;
+
+  Vector<Data> values; // Heap position -> element
+  Vector<Seq> arrival; // Heap position -> arrival number
+  Seq next = 0; // Arrival number of the next insertion
+
+  [[no_unique_address]] Compare comp{};
+
+public:
+
+  // Default constructor
+  PQStable();
+  explicit PQStable(const Compare&); // An empty priority queue ordered by the given comparator
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  PQStable(const TraversableContainer<Data>&, const Compare& = Compare()); // A priority queue obtained from a TraversableContainer (arrival in traversal order)
+  PQStable(MappableContainer<Data>&&, const Compare& = Compare()); // A priority queue obtained from a MappableContainer (arrival in traversal order)
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  PQStable(const PQStable&);
+
+  // Move constructor
+  PQStable(PQStable&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual
+  ~PQStable() = default;
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  PQStable& operator=(const PQStable&);
+
+  // Move assignment
+  PQStable& operator=(PQStable&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const PQStable&) const noexcept; // Same sequence of removals, whatever their heap layout
+  bool operator!=(const PQStable&) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from PQ)
+
+  const Data& Tip() const override; // Override PQ member (the earliest of the greatest; must throw std::length_error when empty)
+  void RemoveTip() override; // Override PQ member (must throw std::length_error when empty)
+  Data TipNRemove() override; // Override PQ member (must throw std::length_error when empty)
+
+  void Insert(const Data&) override; // Override PQ member (Copy of the value)
+  void Insert(Data&&) override; // Override PQ member (Move of the value)
+
+  void Change(ulong, const Data&) override; // Override PQ member (Copy of the value; the element keeps its arrival number)
+  void Change(ulong, Data&&) override; // Override PQ member (Move of the value; the element keeps its arrival number)
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  void Reserve(ulong); // Room for the given number of elements without reallocation
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from LinearContainer)
+
+  const Data& operator[](ulong) const override; // Override LinearContainer member (heap order; must throw std::out_of_range when out of range)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() noexcept override; // Override ClearableContainer member
+
+protected:
+
+  // Auxiliary functions, if necessary!
+
+  bool Beats(const Data&, Seq, const Data&, Seq) const noexcept; // Whether the first element leaves before the second
+  Seq Arrive(); // Hands out the next arrival number
+  void Renumber();
+  void Erase(ulong) noexcept;
+  void Heapify() noexcept;
+  void SiftUp(ulong, Data, Seq) noexcept; // Fills the hole at the given index with the given element and arrival number
+  void SiftDown(ulong, Data, Seq) noexcept; // Fills the hole at the given index with the given element and arrival number
+  static ulong parent(ulong) noexcept;
+  static ulong left(ulong) noexcept; // First child
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "pqstable.cpp"
+
+#endif
@@ -0,0 +1,223 @@
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// ...
+
+template <typename Data, ulong N, ulong Arity, typename Compare>
+PQStatic<Data, N, Arity, Compare>::PQStatic(const Compare& comp)
+  : comp(comp) {}
+
+template <typename Data, ulong N, ulong Arity, typename Compare>
+PQStatic<Data, N, Arity, Compare>::PQStatic(const TraversableContainer<Data>& box, const Compare& comp)
+  : StaticVector<Data, N>(box), comp(comp) {
+  Heapify();
+}
+
+template <typename Data, ulong N, ulong Arity, typename Compare>
+PQStatic<Data, N, Arity, Compare>::PQStatic(MappableContainer<Data>&& box, const Compare& comp)
+  : StaticVector<Data, N>(std::move(box)), comp(comp) {
+  Heapify();
+}
+
+template <typename Data, ulong N, ulong Arity, typename Compare>
+PQStatic<Data, N, Arity, Compare>::PQStatic(const PQStatic<Data, N, Arity, Compare>& other)
+  : StaticVector<Data, N>(other), comp(other.comp) {}
+
+template <typename Data, ulong N, ulong Arity, typename Compare>
+PQStatic<Data, N, Arity, Compare>::PQStatic(PQStatic<Data, N, Arity, Compare>&& other)
+  noexcept : StaticVector<Data, N>(std::move(other)), comp(other.comp) {}
+
+template <typename Data, ulong N, ulong Arity, typename Compare>
+PQStatic<Data, N, Arity, Compare>& PQStatic<Data, N, Arity, Compare>::operator=(const PQStatic<Data, N, Arity, Compare>& other)
+{
+  StaticVector<Data, N>::operator=(other);
+  comp = other.comp;
+  return *this;
+}
+
+template <typename Data, ulong N, ulong Arity, typename Compare>
+PQStatic<Data, N, Arity, Compare>& PQStatic<Data, N, Arity, Compare>::operator=(PQStatic<Data, N, Arity, Compare>&& other)
+  noexcept {
+    StaticVector<Data, N>::operator=(std::move(other));
+    comp = other.comp;
+  return *this;
+}
+
+template <typename Data, ulong N, ulong Arity, typename Compare>
+bool PQStatic<Data, N, Arity, Compare>::operator==(const PQStatic<Data, N, Arity, Compare>& other)
+  const noexcept {
+    if (size != other.size)
+                  return false;
+    PQStatic<Data, N, Arity, Compare> sx(*this);
+    PQStatic<Data, N, Arity, Compare> dx(other);
+    bool diffAbsence = true;
+    while (diffAbsence && !sx.Empty())
+      diffAbsence = (sx.TipNRemove() == dx.TipNRemove());
+  return diffAbsence;
+}
+
+template <typename Data, ulong N, ulong Arity, typename Compare>
+inline bool PQStatic<Data, N, Arity, Compare>::operator!=(const PQStatic<Data, N, Arity, Compare>& other)
+  const noexcept {
+    return !(*this == other);
+}
+
+/* ************************************************************************** */
+
+template <typename Data, ulong N, ulong Arity, typename Compare>
+const Data& PQStatic<Data, N, Arity, Compare>::Tip() const {
+  if (size == 0) {
+    throw std::length_error("Priority queue is empty");
+  }
+  return elements[0];
+}
+
+template <typename Data, ulong N, ulong Arity, typename Compare>
+void PQStatic<Data, N, Arity, Compare>::RemoveTip() {
+  if (size == 0) {
+    throw std::length_error("Priority queue is empty");
+  }
+  Erase(0);
+}
+
+template <typename Data, ulong N, ulong Arity, typename Compare>
+Data PQStatic<Data, N, Arity, Compare>::TipNRemove() {
+  if (size == 0) {
+    throw std::length_error("Priority queue is empty");
+  }
+  Data ret = std::move(elements[0]);
+  Erase(0);
+  return ret;
+}
+
+template <typename Data, ulong N, ulong Arity, typename Compare>
+void PQStatic<Data, N, Arity, Compare>::Insert(const Data& dat) {
+  Data copy = dat;
+  Insert(std::move(copy));
+}
+
+template <typename Data, ulong N, ulong Arity, typename Compare>
+void PQStatic<Data, N, Arity, Compare>::Insert(Data&& dat) {
+  if (!TryInsert(std::move(dat))) {
+    throw std::length_error("Priority queue is full");
+  }
+}
+
+template <typename Data, ulong N, ulong Arity, typename Compare>
+void PQStatic<Data, N, Arity, Compare>::Change(ulong index, const Data& dat) {
+  Data copy = dat;
+  Change(index, std::move(copy));
+}
+
+template <typename Data, ulong N, ulong Arity, typename Compare>
+void PQStatic<Data, N, Arity, Compare>::Change(ulong index, Data&& dat) {
+  if (index >= size) {
+    throw std::out_of_range("Index out of range");
+  }
+  if (comp(elements[index], dat))
+    SiftUp(index, std::move(dat));
+  else
+    SiftDown(index, std::move(dat));
+}
+
+/* ************************************************************************** */
+
+template <typename Data, ulong N, ulong Arity, typename Compare>
+bool PQStatic<Data, N, Arity, Compare>::TryInsert(const Data& dat) {
+  if (size == N)
+        return false;
+  SiftUp(size++, dat);
+  return true;
+}
+
+template <typename Data, ulong N, ulong Arity, typename Compare>
+bool PQStatic<Data, N, Arity, Compare>::TryInsert(Data&& dat) {
+  if (size == N)
+        return false;
+  SiftUp(size++, std::move(dat));
+  return true;
+}
+
+/* ************************************************************************** */
+
+template <typename Data, ulong N, ulong Arity, typename Compare>
+const Data& PQStatic<Data, N, Arity, Compare>::operator[](ulong index) const {
+  if (index >= size) {
+    throw std::out_of_range("Index out of range");
+  }
+  return elements[index];
+}
+
+template <typename Data, ulong N, ulong Arity, typename Compare>
+void PQStatic<Data, N, Arity, Compare>::Clear() noexcept {
+  StaticVector<Data, N>::Clear();
+}
+
+/* ************************************************************************** */
+
+template <typename Data, ulong N, ulong Arity, typename Compare>
+void PQStatic<Data, N, Arity, Compare>::Erase(ulong index) noexcept {
+  if (index == --size) {
+    elements[size] = Data();
+    return;
+  }
+  Data moving = std::move(elements[size]);
+  elements[size] = Data();
+  if (index > 0 && comp(elements[parent(index)], moving))
+    SiftUp(index, std::move(moving));
+  else
+    SiftDown(index, std::move(moving));
+}
+
+template <typename Data, ulong N, ulong Arity, typename Compare>
+void PQStatic<Data, N, Arity, Compare>::Heapify() noexcept {
+  if (size <= 1) return;
+  for (ulong i = parent(size - 1) + 1; i > 0; --i)
+    SiftDown(i - 1, std::move(elements[i - 1]));
+}
+
+// Hole-based sifting as in PQHeap: the moving element is written once, where
+// it finally belongs.
+template <typename Data, ulong N, ulong Arity, typename Compare>
+void PQStatic<Data, N, Arity, Compare>::SiftUp(ulong hole, Data moving) noexcept {
+  while (hole > 0) {
+    ulong par = parent(hole);
+    if (!comp(elements[par], moving))
+                        break;
+    elements[hole] = std::move(elements[par]);
+    hole = par;
+  }
+  elements[hole] = std::move(moving);
+}
+
+template <typename Data, ulong N, ulong Arity, typename Compare>
+void PQStatic<Data, N, Arity, Compare>::SiftDown(ulong hole, Data moving) noexcept {
+  while (left(hole) < size) {
+    ulong first = left(hole);
+    ulong last = std::min(first + Arity, size);
+    ulong max = first;
+    for (ulong c = first + 1; c < last; ++c)
+      max = comp(elements[max], elements[c]) ? c : max;
+    if (!comp(moving, elements[max]))
+                        break;
+    elements[hole] = std::move(elements[max]);
+    hole = max;
+  }
+  elements[hole] = std::move(moving);
+}
+
+template <typename Data, ulong N, ulong Arity, typename Compare>
+inline ulong PQStatic<Data, N, Arity, Compare>::parent(ulong i) noexcept {
+  return (i - 1) / Arity;
+}
+
+template <typename Data, ulong N, ulong Arity, typename Compare>
+inline ulong PQStatic<Data, N, Arity, Compare>::left(ulong i) noexcept {
+  return Arity * i + 1;
+}
+
+/* ************************************************************************** */
+
+}
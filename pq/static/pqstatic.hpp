@@ -0,0 +1,137 @@
+
+#ifndef PQSTATIC_HPP
+#define PQSTATIC_HPP
+
+/* ************************************************************************** */
+
+#include "../pq.hpp"
+#include "../../vector/static/staticvector.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Priority queue of at most N elements on a StaticVector: a d-ary heap that
+// never touches the allocator. TryInsert reports a full queue by returning
+// false; Insert, bound by the PQ interface, throws std::length_error. The tip
+// is the greatest element under Compare, as in PQHeap.
+
+template <typename Data, ulong N, ulong Arity = 2, typename Compare = std::less<Data>>
+class PQStatic : virtual public PQ<Data>, virtual protected StaticVector<Data, N> {
+  // Must extend PQ<Data>,
+  // Could extend StaticVector<Data, N>
+
+  static_assert(Arity >= 2 && (Arity & (Arity - 1)) == 0, "Arity must be a power of two");
+
+private:
+
+  // ...
+
+protected:
+
+  using Container::size;
+  using StaticVector<Data, N>::elements;
+
+  [[no_unique_address]] Compare comp{};
+
+public:
+
+  // Default constructor
+  PQStatic() = default;
+  explicit PQStatic(const Compare&); // An empty priority queue ordered by the given comparator
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  PQStatic(const TraversableContainer<Data>&, const Compare& = Compare()); // A priority queue obtained from a TraversableContainer (must throw std::length_error beyond N)
+  PQStatic(MappableContainer<Data>&&, const Compare& = Compare()); // A priority queue obtained from a MappableContainer (must throw std::length_error beyond N)
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  PQStatic(const PQStatic&);
+
+  // Move constructor
+  PQStatic(PQStatic&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual
+  ~PQStatic() = default;
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  PQStatic& operator=(const PQStatic&);
+
+  // Move assignment
+  PQStatic& operator=(PQStatic&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const PQStatic&) const noexcept; // Same elements, whatever their heap layout
+  bool operator!=(const PQStatic&) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from PQ)
+
+  const Data& Tip() const override; // Override PQ member (must throw std::length_error when empty)
+  void RemoveTip() override; // Override PQ member (must throw std::length_error when empty)
+  Data TipNRemove() override; // Override PQ member (must throw std::length_error when empty)
+
+  void Insert(const Data&) override; // Override PQ member (Copy of the value; must throw std::length_error when full)
+  void Insert(Data&&) override; // Override PQ member (Move of the value; must throw std::length_error when full)
+
+  void Change(ulong, const Data&) override; // Override PQ member (Copy of the value)
+  void Change(ulong, Data&&) override; // Override PQ member (Move of the value)
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  bool TryInsert(const Data&); // Non-throwing counterpart of Insert: false when full, leaving the queue as it is
+  bool TryInsert(Data&&); // Non-throwing counterpart of Insert: false when full, leaving the queue as it is
+
+  using StaticVector<Data, N>::Capacity;
+  using StaticVector<Data, N>::Full;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from LinearContainer)
+
+  const Data& operator[](ulong) const override; // Override LinearContainer member (heap order; must throw std::out_of_range when out of range)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() noexcept override; // Override ClearableContainer member
+
+  using Container::Size;
+  using Container::Empty;
+
+protected:
+
+  // Auxiliary functions, if necessary!
+
+  void Erase(ulong) noexcept;
+  void Heapify() noexcept;
+  void SiftUp(ulong, Data) noexcept; // Fills the hole at the given index with the given element
+  void SiftDown(ulong, Data) noexcept; // Fills the hole at the given index with the given element
+  static ulong parent(ulong) noexcept;
+  static ulong left(ulong) noexcept; // First child
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "pqstatic.cpp"
+
+#endif
@@ -0,0 +1,155 @@
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// ...
+
+template <typename Data, ulong Arity, typename Compare>
+PQTopK<Data, Arity, Compare>::PQTopK(ulong bound, const Compare& comp)
+  : bound(bound), heap(ReverseCompare<Compare>{comp}), comp(comp) {
+  size = 0;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+PQTopK<Data, Arity, Compare>::PQTopK(ulong bound, const TraversableContainer<Data>& box, const Compare& comp)
+  : PQTopK(bound, comp) {
+  box.Traverse(
+    [this](const Data& dat)
+    {
+      Insert(dat);
+    }
+  );
+}
+
+template <typename Data, ulong Arity, typename Compare>
+PQTopK<Data, Arity, Compare>::PQTopK(ulong bound, MappableContainer<Data>&& box, const Compare& comp)
+  : PQTopK(bound, comp) {
+  box.Map(
+    [this](Data& dat)
+    {
+      Insert(std::move(dat));
+    }
+  );
+}
+
+template <typename Data, ulong Arity, typename Compare>
+PQTopK<Data, Arity, Compare>::PQTopK(const PQTopK<Data, Arity, Compare>& other)
+  : bound(other.bound), heap(other.heap), comp(other.comp) {
+  size = other.size;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+PQTopK<Data, Arity, Compare>::PQTopK(PQTopK<Data, Arity, Compare>&& other)
+  noexcept : heap(ReverseCompare<Compare>{other.comp}), comp(other.comp) {
+    size = 0;
+    *this = std::move(other);
+}
+
+template <typename Data, ulong Arity, typename Compare>
+PQTopK<Data, Arity, Compare>& PQTopK<Data, Arity, Compare>::operator=(const PQTopK<Data, Arity, Compare>& other)
+{
+  if (this == &other) return *this;
+
+  PQTopK<Data, Arity, Compare> tmp(other);
+  *this = std::move(tmp);
+  return *this;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+PQTopK<Data, Arity, Compare>& PQTopK<Data, Arity, Compare>::operator=(PQTopK<Data, Arity, Compare>&& other)
+  noexcept {
+    std::swap(size, other.size);
+    std::swap(bound, other.bound);
+    std::swap(heap, other.heap);
+    std::swap(comp, other.comp);
+  return *this;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+inline bool PQTopK<Data, Arity, Compare>::operator==(const PQTopK<Data, Arity, Compare>& other)
+  const noexcept {
+    return size == other.size && Sorted() == other.Sorted();
+}
+
+template <typename Data, ulong Arity, typename Compare>
+inline bool PQTopK<Data, Arity, Compare>::operator!=(const PQTopK<Data, Arity, Compare>& other)
+  const noexcept {
+    return !(*this == other);
+}
+
+/* ************************************************************************** */
+
+template <typename Data, ulong Arity, typename Compare>
+bool PQTopK<Data, Arity, Compare>::Insert(const Data& dat) {
+  if (size == bound && (bound == 0 || !comp(*heap.TryTip(), dat)))
+                          return false;
+  Data copy = dat;
+  return Insert(std::move(copy));
+}
+
+// Below the bound everything is kept; past it, only what beats the root, which
+// it replaces. The root is read through TryTip, which skips the checks of Tip
+// on this hot path.
+template <typename Data, ulong Arity, typename Compare>
+bool PQTopK<Data, Arity, Compare>::Insert(Data&& dat) {
+  if (size < bound) {
+    heap.Insert(std::move(dat));
+    ++size;
+    return true;
+  }
+  if (bound == 0 || !comp(*heap.TryTip(), dat))
+                          return false;
+  heap.Change(0, std::move(dat));
+  return true;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+const Data& PQTopK<Data, Arity, Compare>::Threshold() const {
+  if (size == 0) {
+    throw std::length_error("Top-K is empty");
+  }
+  return heap.Tip();
+}
+
+template <typename Data, ulong Arity, typename Compare>
+inline ulong PQTopK<Data, Arity, Compare>::Bound() const noexcept {
+  return bound;
+}
+
+template <typename Data, ulong Arity, typename Compare>
+inline bool PQTopK<Data, Arity, Compare>::Full() const noexcept {
+  return size == bound;
+}
+
+// Removing from a copy of the heap yields the worst first, so the vector is
+// filled from the back.
+template <typename Data, ulong Arity, typename Compare>
+Vector<Data> PQTopK<Data, Arity, Compare>::Sorted() const {
+  PQHeap<Data, Arity, ReverseCompare<Compare>> copy(heap);
+  Vector<Data> ret(size);
+  for (ulong i = size; i > 0; --i)
+    ret[i - 1] = copy.TipNRemove();
+  return ret;
+}
+
+/* ************************************************************************** */
+
+template <typename Data, ulong Arity, typename Compare>
+const Data& PQTopK<Data, Arity, Compare>::operator[](ulong index) const {
+  if (index >= size) {
+    throw std::out_of_range("Index out of range");
+  }
+  const LinearContainer<Data>& view = heap;
+  return view[index];
+}
+
+template <typename Data, ulong Arity, typename Compare>
+void PQTopK<Data, Arity, Compare>::Clear() noexcept {
+  heap.Clear();
+  size = 0;
+}
+
+/* ************************************************************************** */
+
+}
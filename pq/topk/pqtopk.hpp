@@ -0,0 +1,123 @@
+
+#ifndef PQTOPK_HPP
+#define PQTOPK_HPP
+
+/* ************************************************************************** */
+
+#include "../heap/pqheap.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// The opposite order of a comparator: ReverseCompare<std::less<Data>> acts as
+// std::greater<Data>.
+template <typename Compare>
+struct ReverseCompare {
+
+  [[no_unique_address]] Compare comp{};
+
+  template <typename Data>
+  bool operator()(const Data& sx, const Data& dx) const { return comp(dx, sx); }
+
+};
+
+/* ************************************************************************** */
+
+// Bounded top-K: keeps only the K greatest elements (under Compare) of a
+// stream, in a PQHeap ordered the opposite way, so that the worst element
+// kept sits at the root. Once K elements are kept, an element no better than
+// the root is rejected after a single comparison, and a better one replaces
+// the root and sifts down in O(log K). Memory stays O(K) however long the
+// stream.
+
+template <typename Data, ulong Arity = 2, typename Compare = std::less<Data>>
+class PQTopK : virtual public LinearContainer<Data>, virtual public ClearableContainer {
+  // Must extend LinearContainer<Data>,
+  //             ClearableContainer
+
+private:
+
+  // ...
+
+protected:
+
+  using Container::size;
+
+  ulong bound = 0;
+  PQHeap<Data, Arity, ReverseCompare<Compare>> heap; // Worst element kept at the root
+
+  [[no_unique_address]] Compare comp{};
+
+public:
+
+  // Specific constructors
+  explicit PQTopK(ulong, const Compare& = Compare()); // Keeps the given number of elements
+  PQTopK(ulong, const TraversableContainer<Data>&, const Compare& = Compare()); // The best elements of a TraversableContainer
+  PQTopK(ulong, MappableContainer<Data>&&, const Compare& = Compare()); // The best elements of a MappableContainer
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  PQTopK(const PQTopK&);
+
+  // Move constructor
+  PQTopK(PQTopK&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual
+  ~PQTopK() = default;
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  PQTopK& operator=(const PQTopK&);
+
+  // Move assignment
+  PQTopK& operator=(PQTopK&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const PQTopK&) const noexcept; // Same elements kept, whatever their layout
+  bool operator!=(const PQTopK&) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  bool Insert(const Data&); // Copy of the value (false when rejected)
+  bool Insert(Data&&); // Move of the value (false when rejected)
+
+  const Data& Threshold() const; // The worst element kept (must throw std::length_error when empty)
+
+  ulong Bound() const noexcept;
+  bool Full() const noexcept;
+
+  Vector<Data> Sorted() const; // The elements kept, best first
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from LinearContainer)
+
+  const Data& operator[](ulong) const override; // Override LinearContainer member (heap order, worst first; must throw std::out_of_range when out of range)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() noexcept override; // Override ClearableContainer member
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "pqtopk.cpp"
+
+#endif
@@ -0,0 +1,370 @@
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// ...
+
+template <typename Data, typename KeyOf>
+const ulong PQWheel<Data, KeyOf>::initialSlotSize = 4;
+
+template <typename Data, typename KeyOf>
+PQWheel<Data, KeyOf>::PQWheel()
+  : slots(numSlots), count(numSlots) {
+  size = 0;
+}
+
+template <typename Data, typename KeyOf>
+PQWheel<Data, KeyOf>::PQWheel(const KeyOf& keyOf)
+  : slots(numSlots), count(numSlots), overflow(Later{keyOf}), keyOf(keyOf) {
+  size = 0;
+}
+
+template <typename Data, typename KeyOf>
+PQWheel<Data, KeyOf>::PQWheel(const TraversableContainer<Data>& box, const KeyOf& keyOf)
+  : PQWheel(keyOf) {
+  box.Traverse(
+    [this](const Data& dat)
+    {
+      Insert(dat);
+    }
+  );
+}
+
+template <typename Data, typename KeyOf>
+PQWheel<Data, KeyOf>::PQWheel(MappableContainer<Data>&& box, const KeyOf& keyOf)
+  : PQWheel(keyOf) {
+  box.Map(
+    [this](Data& dat)
+    {
+      Insert(std::move(dat));
+    }
+  );
+}
+
+template <typename Data, typename KeyOf>
+PQWheel<Data, KeyOf>::PQWheel(const PQWheel<Data, KeyOf>& other)
+  : slots(other.slots), count(other.count), wheelSize(other.wheelSize), now(other.now),
+    overflow(other.overflow), tipKnown(other.tipKnown), tipSlot(other.tipSlot),
+    tipIndex(other.tipIndex), keyOf(other.keyOf) {
+  size = other.size;
+  for (ulong l = 0; l < numLevels; ++l)
+    for (ulong w = 0; w < wordsPerLevel; ++w)
+      occupied[l][w] = other.occupied[l][w];
+}
+
+template <typename Data, typename KeyOf>
+PQWheel<Data, KeyOf>::PQWheel(PQWheel<Data, KeyOf>&& other)
+  noexcept : slots(numSlots), count(numSlots), overflow(Later{other.keyOf}), keyOf(other.keyOf) {
+    size = 0;
+    *this = std::move(other);
+}
+
+template <typename Data, typename KeyOf>
+PQWheel<Data, KeyOf>& PQWheel<Data, KeyOf>::operator=(const PQWheel<Data, KeyOf>& other)
+{
+  if (this == &other) return *this;
+
+  PQWheel<Data, KeyOf> tmp(other);
+  *this = std::move(tmp);
+  return *this;
+}
+
+template <typename Data, typename KeyOf>
+PQWheel<Data, KeyOf>& PQWheel<Data, KeyOf>::operator=(PQWheel<Data, KeyOf>&& other)
+  noexcept {
+    std::swap(size, other.size);
+    std::swap(slots, other.slots);
+    std::swap(count, other.count);
+    std::swap(occupied, other.occupied);
+    std::swap(wheelSize, other.wheelSize);
+    std::swap(now, other.now);
+    std::swap(overflow, other.overflow);
+    std::swap(tipKnown, other.tipKnown);
+    std::swap(tipSlot, other.tipSlot);
+    std::swap(tipIndex, other.tipIndex);
+    std::swap(keyOf, other.keyOf);
+  return *this;
+}
+
+template <typename Data, typename KeyOf>
+bool PQWheel<Data, KeyOf>::operator==(const PQWheel<Data, KeyOf>& other)
+  const noexcept {
+    if (size != other.size)
+                  return false;
+    PQWheel<Data, KeyOf> sx(*this);
+    PQWheel<Data, KeyOf> dx(other);
+    bool diffAbsence = true;
+    while (diffAbsence && !sx.Empty())
+      diffAbsence = (sx.TipNRemove() == dx.TipNRemove());
+  return diffAbsence;
+}
+
+template <typename Data, typename KeyOf>
+inline bool PQWheel<Data, KeyOf>::operator!=(const PQWheel<Data, KeyOf>& other)
+  const noexcept {
+    return !(*this == other);
+}
+
+/* ************************************************************************** */
+
+// Looking at the tip does not move anything: the first non-empty slot of the
+// lowest non-empty level is searched for once and remembered until the next
+// removal. Far-future elements only matter once the wheel is empty.
+template <typename Data, typename KeyOf>
+const Data& PQWheel<Data, KeyOf>::Tip() const {
+  if (size == 0) {
+    throw std::length_error("Priority queue is empty");
+  }
+  if (wheelSize == 0)
+    return overflow.Tip();
+  FindTip();
+  return slots[tipSlot][tipIndex];
+}
+
+template <typename Data, typename KeyOf>
+void PQWheel<Data, KeyOf>::RemoveTip() {
+  if (size == 0) {
+    throw std::length_error("Priority queue is empty");
+  }
+  ulong s = Advance();
+  Data* buf = &slots[s][0];
+  buf[count[s] - 1] = Data();
+  Erase(s);
+  --size;
+}
+
+template <typename Data, typename KeyOf>
+Data PQWheel<Data, KeyOf>::TipNRemove() {
+  if (size == 0) {
+    throw std::length_error("Priority queue is empty");
+  }
+  ulong s = Advance();
+  Data* buf = &slots[s][0];
+  Data ret = std::move(buf[count[s] - 1]);
+  buf[count[s] - 1] = Data();
+  Erase(s);
+  --size;
+  return ret;
+}
+
+template <typename Data, typename KeyOf>
+void PQWheel<Data, KeyOf>::Insert(const Data& dat) {
+  Data copy = dat;
+  Insert(std::move(copy));
+}
+
+template <typename Data, typename KeyOf>
+void PQWheel<Data, KeyOf>::Insert(Data&& dat) {
+  Admit(dat);
+  Place(std::move(dat));
+  ++size;
+}
+
+template <typename Data, typename KeyOf>
+void PQWheel<Data, KeyOf>::Change(ulong index, const Data& dat) {
+  Data copy = dat;
+  Change(index, std::move(copy));
+}
+
+// An element on the wheel leaves its slot and the new one is placed as usual.
+// One in the overflow is changed there: if it now belongs on the wheel, its
+// key is below any other in the overflow, so it surfaces at the tip of the
+// heap, whence it is moved.
+template <typename Data, typename KeyOf>
+void PQWheel<Data, KeyOf>::Change(ulong index, Data&& dat) {
+  if (index >= size) {
+    throw std::out_of_range("Index out of range");
+  }
+  Admit(dat);
+  if (index >= wheelSize) {
+    bool near = LevelOf(keyOf(dat)) < numLevels;
+    overflow.Change(index - wheelSize, std::move(dat));
+    if (near)
+      Place(overflow.TipNRemove());
+    return;
+  }
+  ulong s, i;
+  Locate(index, s, i);
+  Vector<Data>& slot = slots[s];
+  slot[i] = std::move(slot[count[s] - 1]);
+  slot[count[s] - 1] = Data();
+  Erase(s);
+  Place(std::move(dat));
+}
+
+/* ************************************************************************** */
+
+template <typename Data, typename KeyOf>
+inline ulong PQWheel<Data, KeyOf>::Now() const noexcept {
+  return now;
+}
+
+template <typename Data, typename KeyOf>
+inline ulong PQWheel<Data, KeyOf>::Overflowing() const noexcept {
+  return overflow.Size();
+}
+
+/* ************************************************************************** */
+
+template <typename Data, typename KeyOf>
+const Data& PQWheel<Data, KeyOf>::operator[](ulong index) const {
+  if (index >= size) {
+    throw std::out_of_range("Index out of range");
+  }
+  if (index >= wheelSize) {
+    const LinearContainer<Data>& view = overflow;
+    return view[index - wheelSize];
+  }
+  ulong s, i;
+  Locate(index, s, i);
+  return slots[s][i];
+}
+
+template <typename Data, typename KeyOf>
+void PQWheel<Data, KeyOf>::Clear() noexcept {
+  PQWheel<Data, KeyOf> empty(keyOf);
+  *this = std::move(empty);
+}
+
+/* ************************************************************************** */
+
+template <typename Data, typename KeyOf>
+void PQWheel<Data, KeyOf>::Admit(const Data& dat) const {
+  if (keyOf(dat) < now) {
+    throw std::invalid_argument("Key below the current time");
+  }
+}
+
+template <typename Data, typename KeyOf>
+inline ulong PQWheel<Data, KeyOf>::LevelOf(ulong key) const noexcept {
+  ulong diff = key ^ now;
+  return (diff < slotsPerLevel) ? 0 : (std::bit_width(diff) - 1) / slotBits;
+}
+
+template <typename Data, typename KeyOf>
+inline ulong PQWheel<Data, KeyOf>::SlotOf(ulong level, ulong key) const noexcept {
+  return level * slotsPerLevel + ((key >> (level * slotBits)) & (slotsPerLevel - 1));
+}
+
+// Slots are numbered level by level, and every key on a level is below any
+// key on the next one, so a lower slot number means a smaller key.
+template <typename Data, typename KeyOf>
+void PQWheel<Data, KeyOf>::Place(Data&& dat) {
+  ulong key = keyOf(dat);
+  ulong l = LevelOf(key);
+  if (l >= numLevels) {
+    overflow.Insert(std::move(dat));
+    return;
+  }
+  ulong s = SlotOf(l, key);
+  if (tipKnown && (s < tipSlot || (s == tipSlot && key < keyOf(slots[tipSlot][tipIndex])))) {
+    tipSlot = s;
+    tipIndex = count[s];
+  }
+  Append(s, std::move(dat));
+  ++wheelSize;
+}
+
+template <typename Data, typename KeyOf>
+void PQWheel<Data, KeyOf>::Append(ulong s, Data&& dat) {
+  Vector<Data>& slot = (&slots[0])[s];
+  ulong& n = (&count[0])[s];
+  if (n == slot.Size())
+    slot.Resize(std::max(initialSlotSize, 2 * n));
+  if (n == 0)
+    occupied[s / slotsPerLevel][(s % slotsPerLevel) / 64] |= 1UL << (s % 64);
+  Data* buf = &slot[0];
+  buf[n++] = std::move(dat);
+}
+
+// Drops the last element of a slot, already moved away by the caller.
+template <typename Data, typename KeyOf>
+void PQWheel<Data, KeyOf>::Erase(ulong s) noexcept {
+  ulong& n = (&count[0])[s];
+  if (--n == 0)
+    occupied[s / slotsPerLevel][(s % slotsPerLevel) / 64] &= ~(1UL << (s % 64));
+  --wheelSize;
+  tipKnown = false;
+}
+
+template <typename Data, typename KeyOf>
+ulong PQWheel<Data, KeyOf>::NextOccupied(ulong level, ulong from) const noexcept {
+  ulong w = from / 64;
+  ulong bits = occupied[level][w] & (~0UL << (from % 64));
+  while (bits == 0) {
+    if (++w == wordsPerLevel)
+            return slotsPerLevel;
+    bits = occupied[level][w];
+  }
+  return w * 64 + std::countr_zero(bits);
+}
+
+// Every key on level l shares with the current time the bytes above l, and
+// its byte l is no smaller; the first non-empty slot of the lowest non-empty
+// level thus holds the tip. On level 0 all the keys of a slot are equal.
+template <typename Data, typename KeyOf>
+void PQWheel<Data, KeyOf>::FindTip() const noexcept {
+  if (tipKnown)
+          return;
+  ulong l = 0;
+  ulong s = slotsPerLevel;
+  while ((s = NextOccupied(l, (now >> (l * slotBits)) & (slotsPerLevel - 1))) == slotsPerLevel)
+    ++l;
+  tipSlot = l * slotsPerLevel + s;
+  const Data* buf = &slots[tipSlot][0];
+  ulong min = count[tipSlot] - 1;
+  if (l > 0)
+    for (ulong i = 0; i < count[tipSlot] - 1; ++i)
+      if (keyOf(buf[i]) < keyOf(buf[min]))
+        min = i;
+  tipIndex = min;
+  tipKnown = true;
+}
+
+// Moves the current time to the tip. When the tip is on a higher level, its
+// slot cascades: the smallest key of the slot becomes the current time, and
+// each of its elements now differs from it in a lower byte only, so it lands
+// on a lower level, the tip itself on level 0.
+template <typename Data, typename KeyOf>
+ulong PQWheel<Data, KeyOf>::Advance() {
+  if (wheelSize == 0)
+    Drain();
+  FindTip();
+  ulong s = tipSlot;
+  Vector<Data>& slot = slots[s];
+  now = keyOf(slot[tipIndex]);
+  if (s < slotsPerLevel)
+          return s;
+  ulong n = count[s];
+  Data* buf = &slot[0];
+  count[s] = 0;
+  occupied[s / slotsPerLevel][(s % slotsPerLevel) / 64] &= ~(1UL << (s % 64));
+  wheelSize -= n;
+  tipKnown = false;
+  for (ulong i = 0; i < n; ++i)
+    Place(std::move(buf[i]));
+  return SlotOf(0, now);
+}
+
+// With the wheel empty, the current time jumps to the earliest far-future
+// key, and every overflowing element now close enough joins the wheel.
+template <typename Data, typename KeyOf>
+void PQWheel<Data, KeyOf>::Drain() {
+  now = keyOf(overflow.Tip());
+  const Data* next;
+  while ((next = overflow.TryTip()) != nullptr && LevelOf(keyOf(*next)) < numLevels)
+    Place(overflow.TipNRemove());
+}
+
+template <typename Data, typename KeyOf>
+void PQWheel<Data, KeyOf>::Locate(ulong index, ulong& s, ulong& i) const {
+  s = 0;
+  while (index >= count[s])
+    index -= count[s++];
+  i = index;
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,176 @@
+
+#ifndef PQWHEEL_HPP
+#define PQWHEEL_HPP
+
+/* ************************************************************************** */
+
+#include <bit>
+
+/* ************************************************************************** */
+
+#include "../pq.hpp"
+#include "../heap/pqheap.hpp"
+#include "../radix/pqradix.hpp"
+#include "../../vector/vector.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Hierarchical timing wheel: a monotone min-priority queue over unsigned
+// timestamps, for timers whose deadlines mostly lie in the near future. As in
+// PQRadix, the key of every element inserted must be no smaller than the
+// current time, that is the key of the last element removed
+// (std::invalid_argument otherwise). The wheel has four levels of 256 slots;
+// an element sits on the level of the highest byte in which its key differs
+// from the current time, in the slot given by that byte of its key, so that
+// slots on level 0 hold exact ticks. Keys 2^32 ticks or more ahead overflow
+// into a PQHeap, drained when the wheel runs empty. Insert is O(1); when
+// level 0 has nothing left, the first non-empty slot of the lowest level
+// cascades into the levels below, each element moving at most once per level,
+// hence amortized O(1) per removal. The tip is the element with the smallest
+// key.
+
+template <typename Data, typename KeyOf = RadixKey<Data>>
+class PQWheel : virtual public PQ<Data> {
+  // Must extend PQ<Data>
+
+private:
+
+  // ...
+
+protected:
+
+  using Container::size;
+
+  static const ulong slotBits = 8;
+  static const ulong slotsPerLevel = 1UL << slotBits;
+  static const ulong numLevels = 4; // Keys up to 2^32 ticks ahead stay on the wheel
+  static const ulong numSlots = numLevels * slotsPerLevel;
+  static const ulong wordsPerLevel = slotsPerLevel / 64;
+  static const ulong initialSlotSize;
+
+  // Orders far-future elements in the overflow heap, earliest at the tip
+  struct Later {
+
+    [[no_unique_address]] KeyOf keyOf{};
+
+    bool operator()(const Data& sx, const Data& dx) const noexcept { return keyOf(sx) > keyOf(dx); }
+
+  };
+
+  Vector<Vector<Data>> slots; // Level by level
+  Vector<ulong> count;
+  ulong occupied[numLevels][wordsPerLevel] = {}; // One bit per non-empty slot
+  ulong wheelSize = 0; // Elements on the wheel, the others being in the overflow
+  ulong now = 0; // Key of the last element removed
+
+  PQHeap<Data, 4, Later> overflow;
+
+  // Where the tip is, when the wheel is not empty and it has already been looked for
+  mutable bool tipKnown = false;
+  mutable ulong tipSlot = 0;
+  mutable ulong tipIndex = 0;
+
+  [[no_unique_address]] KeyOf keyOf{};
+
+public:
+
+  // Default constructor
+  PQWheel();
+  explicit PQWheel(const KeyOf&); // An empty priority queue using the given key extractor
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  PQWheel(const TraversableContainer<Data>&, const KeyOf& = KeyOf()); // A priority queue obtained from a TraversableContainer
+  PQWheel(MappableContainer<Data>&&, const KeyOf& = KeyOf()); // A priority queue obtained from a MappableContainer
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  PQWheel(const PQWheel&);
+
+  // Move constructor
+  PQWheel(PQWheel&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual
+  ~PQWheel() = default;
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  PQWheel& operator=(const PQWheel&);
+
+  // Move assignment
+  PQWheel& operator=(PQWheel&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const PQWheel&) const noexcept; // Same sequence of removals, whatever their slots
+  bool operator!=(const PQWheel&) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from PQ)
+
+  const Data& Tip() const override; // Override PQ member (must throw std::length_error when empty)
+  void RemoveTip() override; // Override PQ member (must throw std::length_error when empty)
+  Data TipNRemove() override; // Override PQ member (must throw std::length_error when empty)
+
+  void Insert(const Data&) override; // Override PQ member (Copy of the value; must throw std::invalid_argument when below the current time)
+  void Insert(Data&&) override; // Override PQ member (Move of the value; must throw std::invalid_argument when below the current time)
+
+  void Change(ulong, const Data&) override; // Override PQ member (Copy of the value; must throw std::invalid_argument when below the current time)
+  void Change(ulong, Data&&) override; // Override PQ member (Move of the value; must throw std::invalid_argument when below the current time)
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  ulong Now() const noexcept; // Current time: lower bound for the keys that may be inserted
+  ulong Overflowing() const noexcept; // Elements too far ahead for the wheel
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from LinearContainer)
+
+  const Data& operator[](ulong) const override; // Override LinearContainer member (slot by slot, then the overflow; must throw std::out_of_range when out of range)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() noexcept override; // Override ClearableContainer member
+
+protected:
+
+  // Auxiliary functions, if necessary!
+
+  void Admit(const Data&) const; // (must throw std::invalid_argument when below the current time)
+  ulong LevelOf(ulong) const noexcept; // numLevels or more for the overflow
+  ulong SlotOf(ulong, ulong) const noexcept;
+  void Place(Data&&);
+  void Append(ulong, Data&&);
+  void Erase(ulong) noexcept;
+  ulong NextOccupied(ulong, ulong) const noexcept; // First non-empty slot of a level from a given one (slotsPerLevel if none)
+  void FindTip() const noexcept;
+  ulong Advance(); // Level 0 slot holding the tip at its back
+  void Drain();
+  void Locate(ulong, ulong&, ulong&) const; // Slot and index of a position on the wheel
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "pqwheel.cpp"
+
+#endif
@@ -0,0 +1,156 @@
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// ...
+
+template <typename Data, ulong N, typename Compare>
+constexpr SetFrozen<Data, N, Compare>::SetFrozen(const Data (&keys)[N], const Compare& comp)
+  : comp(comp) {
+  for (ulong i = 0; i < N; ++i)
+    elements[i] = keys[i];
+  HeapSortRange<2>(elements, N, comp);
+  size = 1;
+  for (ulong i = 1; i < N; ++i)
+    if (comp(elements[size - 1], elements[i]))
+      elements[size++] = std::move(elements[i]);
+  for (ulong i = size; i < N; ++i)
+    elements[i] = Data();
+}
+
+template <typename Data, ulong N, typename Compare>
+constexpr bool SetFrozen<Data, N, Compare>::operator==(const SetFrozen<Data, N, Compare>& other)
+  const noexcept {
+    if (size != other.size)
+                  return false;
+    for (ulong i = 0; i < size; ++i)
+      if (comp(elements[i], other.elements[i]) || comp(other.elements[i], elements[i]))
+        return false;
+  return true;
+}
+
+template <typename Data, ulong N, typename Compare>
+constexpr bool SetFrozen<Data, N, Compare>::operator!=(const SetFrozen<Data, N, Compare>& other)
+  const noexcept {
+    return !(*this == other);
+}
+
+/* ************************************************************************** */
+
+template <typename Data, ulong N, typename Compare>
+constexpr ulong SetFrozen<Data, N, Compare>::Size() const noexcept {
+  return size;
+}
+
+template <typename Data, ulong N, typename Compare>
+constexpr bool SetFrozen<Data, N, Compare>::Empty() const noexcept {
+  return size == 0;
+}
+
+template <typename Data, ulong N, typename Compare>
+constexpr const Data& SetFrozen<Data, N, Compare>::operator[](ulong index) const {
+  if (index >= size) {
+    throw std::out_of_range("Index out of range");
+  }
+  return elements[index];
+}
+
+template <typename Data, ulong N, typename Compare>
+constexpr bool SetFrozen<Data, N, Compare>::Exists(const Data& dat) const noexcept {
+  ulong r = Rank(dat);
+  return r < size && !comp(dat, elements[r]);
+}
+
+template <typename Data, ulong N, typename Compare>
+constexpr const Data& SetFrozen<Data, N, Compare>::Min() const {
+  if (size == 0) {
+    throw std::length_error("Set is empty");
+  }
+  return elements[0];
+}
+
+template <typename Data, ulong N, typename Compare>
+constexpr const Data& SetFrozen<Data, N, Compare>::Max() const {
+  if (size == 0) {
+    throw std::length_error("Set is empty");
+  }
+  return elements[size - 1];
+}
+
+template <typename Data, ulong N, typename Compare>
+constexpr const Data& SetFrozen<Data, N, Compare>::Predecessor(const Data& dat) const {
+  const Data* pred = TryPredecessor(dat);
+  if (pred == nullptr) {
+    throw std::length_error("Predecessor not found");
+  }
+  return *pred;
+}
+
+template <typename Data, ulong N, typename Compare>
+constexpr const Data& SetFrozen<Data, N, Compare>::Successor(const Data& dat) const {
+  const Data* succ = TrySuccessor(dat);
+  if (succ == nullptr) {
+    throw std::length_error("Successor not found");
+  }
+  return *succ;
+}
+
+template <typename Data, ulong N, typename Compare>
+constexpr ulong SetFrozen<Data, N, Compare>::Rank(const Data& dat) const noexcept {
+  ulong lo = 0, hi = size;
+  while (lo < hi) {
+    ulong mid = lo + (hi - lo) / 2;
+    if (comp(elements[mid], dat))
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo;
+}
+
+template <typename Data, ulong N, typename Compare>
+constexpr const Data& SetFrozen<Data, N, Compare>::Select(ulong k) const {
+  return (*this)[k];
+}
+
+template <typename Data, ulong N, typename Compare>
+constexpr const Data* SetFrozen<Data, N, Compare>::TryMin() const noexcept {
+  return (size == 0) ? nullptr : &elements[0];
+}
+
+template <typename Data, ulong N, typename Compare>
+constexpr const Data* SetFrozen<Data, N, Compare>::TryMax() const noexcept {
+  return (size == 0) ? nullptr : &elements[size - 1];
+}
+
+template <typename Data, ulong N, typename Compare>
+constexpr const Data* SetFrozen<Data, N, Compare>::TryPredecessor(const Data& dat) const noexcept {
+  ulong r = Rank(dat);
+  return (r == 0) ? nullptr : &elements[r - 1];
+}
+
+template <typename Data, ulong N, typename Compare>
+constexpr const Data* SetFrozen<Data, N, Compare>::TrySuccessor(const Data& dat) const noexcept {
+  ulong r = UpperRank(dat);
+  return (r == size) ? nullptr : &elements[r];
+}
+
+/* ************************************************************************** */
+
+template <typename Data, ulong N, typename Compare>
+constexpr ulong SetFrozen<Data, N, Compare>::UpperRank(const Data& dat) const noexcept {
+  ulong lo = 0, hi = size;
+  while (lo < hi) {
+    ulong mid = lo + (hi - lo) / 2;
+    if (comp(dat, elements[mid]))
+      hi = mid;
+    else
+      lo = mid + 1;
+  }
+  return lo;
+}
+
+/* ************************************************************************** */
+
+}
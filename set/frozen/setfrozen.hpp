@@ -0,0 +1,121 @@
+
+#ifndef SETFROZEN_HPP
+#define SETFROZEN_HPP
+
+/* ************************************************************************** */
+
+#include <functional>
+#include <stdexcept>
+
+/* ************************************************************************** */
+
+#include "../../container/sorting.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Frozen set: up to N keys fixed at construction, sorted with heapsort and
+// stripped of duplicates, then only looked up by binary search. Being a
+// literal type with no virtual base, it can be built in a constexpr variable
+// and embedded in the binary with no work left for run time; its lookups are
+// constexpr as well. It offers the lookups of an OrderedDictionaryContainer
+// without extending it. Two keys are the same when neither is less than the
+// other under Compare.
+
+template <typename Data, ulong N, typename Compare = std::less<Data>>
+class SetFrozen {
+
+  static_assert(N > 0, "SetFrozen needs room for at least one key");
+
+private:
+
+  // ...
+
+protected:
+
+  Data elements[N]{}; // Distinct keys in ascending order, then default values
+  ulong size = 0;
+
+  [[no_unique_address]] Compare comp{};
+
+public:
+
+  // Default constructor
+  constexpr SetFrozen() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  constexpr SetFrozen(const Data (&)[N], const Compare& = Compare()); // A set of the keys of an array
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  constexpr SetFrozen(const SetFrozen&) = default;
+
+  // Move constructor
+  constexpr SetFrozen(SetFrozen&&) noexcept = default;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  constexpr ~SetFrozen() = default;
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  constexpr SetFrozen& operator=(const SetFrozen&) = default;
+
+  // Move assignment
+  constexpr SetFrozen& operator=(SetFrozen&&) noexcept = default;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  constexpr bool operator==(const SetFrozen&) const noexcept;
+  constexpr bool operator!=(const SetFrozen&) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  constexpr ulong Size() const noexcept;
+  constexpr bool Empty() const noexcept;
+
+  constexpr const Data& operator[](ulong) const; // (must throw std::out_of_range when out of range)
+
+  constexpr bool Exists(const Data&) const noexcept;
+
+  constexpr const Data& Min() const; // (must throw std::length_error when empty)
+  constexpr const Data& Max() const; // (must throw std::length_error when empty)
+
+  constexpr const Data& Predecessor(const Data&) const; // (must throw std::length_error when not found)
+  constexpr const Data& Successor(const Data&) const; // (must throw std::length_error when not found)
+
+  constexpr ulong Rank(const Data&) const noexcept; // Number of keys strictly less than the given one
+  constexpr const Data& Select(ulong) const; // k-th smallest key, starting from 0 (must throw std::out_of_range when out of range)
+
+  // Non-throwing counterparts of the accessors above: a miss yields nullptr
+  constexpr const Data* TryMin() const noexcept;
+  constexpr const Data* TryMax() const noexcept;
+  constexpr const Data* TryPredecessor(const Data&) const noexcept;
+  constexpr const Data* TrySuccessor(const Data&) const noexcept;
+
+protected:
+
+  // Auxiliary functions, if necessary!
+
+  constexpr ulong UpperRank(const Data&) const noexcept; // Number of keys no greater than the given one
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "setfrozen.cpp"
+
+#endif
@@ -31,6 +31,10 @@ SetLst<Data>::SetLst(MappableContainer<Data> &&box)
   );
 }
 
+template <typename Data>
+SetLst<Data>::SetLst(std::pmr::memory_resource& res)
+  : List<Data>(res) {}
+
 template <typename Data>
 SetLst<Data>::SetLst(const SetLst<Data> &other)
 {
@@ -54,7 +58,7 @@ SetLst<Data> &SetLst<Data>::operator=(const SetLst<Data>& other)
   {
     return *this;
   }
-  head = other.Clone(tail);
+  head = other.Clone(tail, this->resource);
   size = other.size;
   return *this;
 }
@@ -65,6 +69,7 @@ SetLst<Data> &SetLst<Data>::operator=(SetLst<Data> &&other) noexcept
   std::swap(this->head, other.head);
   std::swap(this->tail, other.tail);
   std::swap(this->size, other.size);
+  std::swap(this->resource, other.resource);
   return *this;
 }
 
@@ -149,7 +154,7 @@ inline Data SetLst<Data>::PredecessorNRemove(const Data& dat) {
 
   (*pPred2Nxt) = (*pPred2Nxt)->next;
   size--;
-  delete x;
+  this->DeleteNode(this->resource, x);
 
   return ret;
 }
@@ -203,7 +208,7 @@ inline Data SetLst<Data>::SuccessorNRemove(const Data& dat) {
     return ret;
   }
   (*pSucc2Nxt) = (*pSucc2Nxt)->next;
-  delete x;
+  this->DeleteNode(this->resource, x);
   size--;
   
   return ret;
@@ -214,6 +219,51 @@ inline void SetLst<Data>::RemoveSuccessor(const Data& dat) {
   SuccessorNRemove(dat);
 }
 
+template <typename Data>
+ulong SetLst<Data>::Rank(const Data& dat)
+  const noexcept {
+    ulong rank = 0;
+    for (Node* cur = head; cur != nullptr && dat > cur->key; cur = cur->next)
+                                                                      rank++;
+    return rank;
+}
+
+template <typename Data>
+inline const Data& SetLst<Data>::Select(ulong k)
+  const {
+    return List<Data>::operator[](k);
+}
+
+template <typename Data>
+inline const Data* SetLst<Data>::TryMin()
+  const noexcept {
+    return (head == nullptr) ? nullptr : &head->key;
+}
+
+template <typename Data>
+inline const Data* SetLst<Data>::TryMax()
+  const noexcept {
+    return (tail == nullptr) ? nullptr : &tail->key;
+}
+
+template <typename Data>
+const Data* SetLst<Data>::TryPredecessor(const Data& dat)
+  const noexcept {
+    const Data* pred = nullptr;
+    for (Node* cur = head; cur != nullptr && dat > cur->key; cur = cur->next)
+                                                              pred = &cur->key;
+    return pred;
+}
+
+template <typename Data>
+const Data* SetLst<Data>::TrySuccessor(const Data& dat)
+  const noexcept {
+    Node* cur = head;
+    while (cur != nullptr && !(cur->key > dat))
+                               cur = cur->next;
+    return (cur == nullptr) ? nullptr : &cur->key;
+}
+
 template <typename Data>
 bool SetLst<Data>::Insert(const Data &dat)
 {
@@ -228,7 +278,7 @@ bool SetLst<Data>::Insert(const Data &dat)
     List<Data>::InsertAtBack(dat);
     return true;
   }
-  Node* newNode = new Node(dat);
+  Node* newNode = this->NewNode(this->resource, dat);
 
   if (Empty()) {
     head = newNode;
@@ -256,7 +306,7 @@ bool SetLst<Data>::Insert(Data &&dat)
     List<Data>::InsertAtBack(std::move(dat));
     return true;
   }
-  Node* newNode = new Node(std::move(dat));
+  Node* newNode = this->NewNode(this->resource, std::move(dat));
 
   if (Empty()) {
     head = newNode;
@@ -320,7 +370,7 @@ bool SetLst<Data>::Remove(const Data& dat) {
   Node *x = *foundNode;
   (*foundNode) = (*foundNode)->next;
 
-  delete x;
+  this->DeleteNode(this->resource, x);
   size--;
   
   return true;
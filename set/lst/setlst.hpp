@@ -38,6 +38,7 @@ public:
   // Specific constructors
   SetLst(const TraversableContainer<Data>&); // A set obtained from a TraversableContainer
   SetLst(MappableContainer<Data>&&); // A set obtained from a MappableContainer
+  explicit SetLst(std::pmr::memory_resource&); // An empty set allocating its nodes from the given memory resource
 
   /* ************************************************************************ */
 
@@ -87,6 +88,14 @@ public:
   Data SuccessorNRemove(const Data&) override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
   void RemoveSuccessor(const Data&) override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
 
+  ulong Rank(const Data&) const noexcept override; // Override OrderedDictionaryContainer member
+  const Data& Select(ulong) const override; // Override OrderedDictionaryContainer member (must throw std::out_of_range when out of range)
+
+  const Data* TryMin() const noexcept override; // Override OrderedDictionaryContainer member
+  const Data* TryMax() const noexcept override; // Override OrderedDictionaryContainer member
+  const Data* TryPredecessor(const Data&) const noexcept override; // Override OrderedDictionaryContainer member
+  const Data* TrySuccessor(const Data&) const noexcept override; // Override OrderedDictionaryContainer member
+
   /* ************************************************************************ */
 
   // Specific member functions (inherited from DictionaryContainer)
@@ -121,6 +130,7 @@ public:
   using Set<Data>::RemoveSome;
   using Set<Data>::Front;
   using Set<Data>::Back;
+  using List<Data>::Resource;
 
 protected:
 
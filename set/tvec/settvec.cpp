@@ -0,0 +1,494 @@
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// ...
+
+/* ***********************************Tier*********************************** */
+
+template <typename Data>
+inline bool SetTVec<Data>::Tier::operator==(const Tier& other)
+  const noexcept {
+    if (count != other.count)
+                  return false;
+    bool diffAbsence = true;
+    for (ulong k = 0; diffAbsence && k < count; ++k)
+      diffAbsence = ((*this)[k] == other[k]);
+  return diffAbsence;
+}
+
+template <typename Data>
+inline bool SetTVec<Data>::Tier::operator!=(const Tier& other)
+  const noexcept {
+    return !(*this == other);
+}
+
+template <typename Data>
+inline Data& SetTVec<Data>::Tier::operator[](ulong off)
+{
+  return slots[(head + off) % slots.Size()];
+}
+
+template <typename Data>
+inline const Data& SetTVec<Data>::Tier::operator[](ulong off)
+  const {
+    return slots[(head + off) % slots.Size()];
+}
+
+template <typename Data>
+inline void SetTVec<Data>::Tier::PushFront(Data&& dat)
+{
+  head = (head + slots.Size() - 1) % slots.Size();
+  slots[head] = std::move(dat);
+  count++;
+}
+
+template <typename Data>
+inline void SetTVec<Data>::Tier::PushBack(Data&& dat)
+{
+  (*this)[count] = std::move(dat);
+  count++;
+}
+
+template <typename Data>
+inline Data SetTVec<Data>::Tier::PopFront()
+{
+  Data ret = std::move(slots[head]);
+  head = (head + 1) % slots.Size();
+  count--;
+  return ret;
+}
+
+template <typename Data>
+inline Data SetTVec<Data>::Tier::PopBack()
+{
+  count--;
+  return std::move((*this)[count]);
+}
+
+/* **********************************SetTVec********************************* */
+
+template <typename Data>
+const ulong SetTVec<Data>::minTierSize = 16;
+
+template <typename Data>
+SetTVec<Data>::SetTVec()
+  : tierSize(minTierSize) {
+  size = 0;
+}
+
+template <typename Data>
+SetTVec<Data>::SetTVec(const TraversableContainer<Data>& box)
+  : SetTVec() {
+  box.Traverse(
+    [this](const Data& dat)
+    {
+      Insert(dat);
+    }
+  );
+}
+
+template <typename Data>
+SetTVec<Data>::SetTVec(MappableContainer<Data>&& box)
+  : SetTVec() {
+  box.Map(
+    [this](Data& dat)
+    {
+      Insert(std::move(dat));
+    }
+  );
+}
+
+template <typename Data>
+SetTVec<Data>::SetTVec(const SetTVec<Data>& other)
+  : tierSize(other.tierSize), numTiers(other.numTiers), tiers(other.tiers) {
+  size = other.size;
+}
+
+template <typename Data>
+SetTVec<Data>::SetTVec(SetTVec<Data>&& other)
+  noexcept : SetTVec() {
+    *this = std::move(other);
+}
+
+template <typename Data>
+SetTVec<Data>& SetTVec<Data>::operator=(const SetTVec<Data>& other)
+{
+  if (this == &other) return *this;
+
+  SetTVec<Data> tmp(other);
+  *this = std::move(tmp);
+  return *this;
+}
+
+template <typename Data>
+SetTVec<Data>& SetTVec<Data>::operator=(SetTVec<Data>&& other)
+  noexcept {
+    std::swap(size, other.size);
+    std::swap(tierSize, other.tierSize);
+    std::swap(numTiers, other.numTiers);
+    std::swap(tiers, other.tiers);
+  return *this;
+}
+
+template <typename Data>
+inline bool SetTVec<Data>::operator==(const SetTVec<Data>& other)
+  const noexcept {
+    return LinearContainer<Data>::operator==(other);
+}
+
+template <typename Data>
+inline bool SetTVec<Data>::operator!=(const SetTVec<Data>& other)
+  const noexcept {
+    return !(*this == other);
+}
+
+template <typename Data>
+inline const Data& SetTVec<Data>::Min()
+  const {
+    if (Container::Empty()) throw std::length_error("Set is empty");
+  return At(0);
+}
+
+template <typename Data>
+inline Data SetTVec<Data>::MinNRemove()
+{
+  if (Container::Empty()) throw std::length_error("Set is empty");
+  Data ret = std::move(At(0));
+  CloseGap(0);
+  return ret;
+}
+
+template <typename Data>
+inline void SetTVec<Data>::RemoveMin()
+{
+  if (Container::Empty()) throw std::length_error("Set is empty");
+  CloseGap(0);
+}
+
+template <typename Data>
+inline const Data& SetTVec<Data>::Max()
+  const {
+    if (Container::Empty()) throw std::length_error("Set is empty");
+  return At(size - 1);
+}
+
+template <typename Data>
+inline Data SetTVec<Data>::MaxNRemove()
+{
+  if (Container::Empty()) throw std::length_error("Set is empty");
+  Data ret = std::move(At(size - 1));
+  CloseGap(size - 1);
+  return ret;
+}
+
+template <typename Data>
+inline void SetTVec<Data>::RemoveMax()
+{
+  if (Container::Empty()) throw std::length_error("Set is empty");
+  CloseGap(size - 1);
+}
+
+template <typename Data>
+inline ulong SetTVec<Data>::FindPred(const Data& dat)
+  const {
+    int idx = BSearch(dat);
+    if (idx == -1 || At(idx) == dat)
+                            idx--;
+    if (idx < 0)
+      throw std::length_error("No predecessor found");
+
+  return idx;
+}
+
+template <typename Data>
+inline const Data& SetTVec<Data>::Predecessor(const Data& dat)
+  const {
+    return At(FindPred(dat));
+}
+
+template <typename Data>
+inline Data SetTVec<Data>::PredecessorNRemove(const Data& dat)
+{
+  ulong idx = FindPred(dat);
+  Data ret = std::move(At(idx));
+  CloseGap(idx);
+  return ret;
+}
+
+template <typename Data>
+inline void SetTVec<Data>::RemovePredecessor(const Data& dat)
+{
+  CloseGap(FindPred(dat));
+}
+
+template <typename Data>
+inline ulong SetTVec<Data>::FindSucc(const Data& dat)
+  const {
+    int idx = BSearch(dat) + 1;
+    if (idx >= static_cast<int>(size))
+      throw std::length_error("No successor found");
+
+  return idx;
+}
+
+template <typename Data>
+inline const Data& SetTVec<Data>::Successor(const Data& dat)
+  const {
+    return At(FindSucc(dat));
+}
+
+template <typename Data>
+inline Data SetTVec<Data>::SuccessorNRemove(const Data& dat)
+{
+  ulong idx = FindSucc(dat);
+  Data ret = std::move(At(idx));
+  CloseGap(idx);
+  return ret;
+}
+
+template <typename Data>
+inline void SetTVec<Data>::RemoveSuccessor(const Data& dat)
+{
+  CloseGap(FindSucc(dat));
+}
+
+template <typename Data>
+inline ulong SetTVec<Data>::Rank(const Data& dat)
+  const noexcept {
+    int idx = BSearch(dat);
+    if (idx == -1)
+            return 0;
+    return (At(idx) == dat) ? idx : idx + 1;
+}
+
+template <typename Data>
+inline const Data& SetTVec<Data>::Select(ulong k)
+  const {
+    return (*this)[k];
+}
+
+template <typename Data>
+inline const Data* SetTVec<Data>::TryMin()
+  const noexcept {
+    return (size == 0) ? nullptr : &At(0);
+}
+
+template <typename Data>
+inline const Data* SetTVec<Data>::TryMax()
+  const noexcept {
+    return (size == 0) ? nullptr : &At(size - 1);
+}
+
+template <typename Data>
+inline const Data* SetTVec<Data>::TryPredecessor(const Data& dat)
+  const noexcept {
+    int idx = BSearch(dat);
+    if (idx != -1 && At(idx) == dat)
+                            idx--;
+    return (idx < 0) ? nullptr : &At(idx);
+}
+
+template <typename Data>
+inline const Data* SetTVec<Data>::TrySuccessor(const Data& dat)
+  const noexcept {
+    int idx = BSearch(dat) + 1;
+    return (idx >= static_cast<int>(size)) ? nullptr : &At(idx);
+}
+
+template <typename Data>
+bool SetTVec<Data>::Insert(const Data& dat)
+{
+  int foundIndex = BSearch(dat);
+  if (foundIndex != -1 && At(foundIndex) == dat)
+                                      return false;
+
+  OpenGap(foundIndex + 1);
+  At(foundIndex + 1) = dat;
+  return true;
+}
+
+template <typename Data>
+bool SetTVec<Data>::Insert(Data&& dat)
+{
+  int foundIndex = BSearch(dat);
+  if (foundIndex != -1 && At(foundIndex) == dat)
+                                      return false;
+
+  OpenGap(foundIndex + 1);
+  At(foundIndex + 1) = std::move(dat);
+  return true;
+}
+
+template <typename Data>
+bool SetTVec<Data>::Remove(const Data& dat)
+{
+  int foundIndex = BSearch(dat);
+  if (foundIndex == -1 || At(foundIndex) != dat)
+                                      return false;
+
+  CloseGap(foundIndex);
+  return true;
+}
+
+template <typename Data>
+inline const Data& SetTVec<Data>::operator[](ulong idx)
+  const {
+    if (idx >= size)
+      throw std::out_of_range("Index out of range");
+  return At(idx);
+}
+
+template <typename Data>
+inline bool SetTVec<Data>::Exists(const Data& dat)
+  const noexcept {
+    int foundIndex = BSearch(dat);
+  return (foundIndex != -1 && At(foundIndex) == dat);
+}
+
+template <typename Data>
+void SetTVec<Data>::Clear()
+  noexcept {
+    tiers = Vector<Tier>();
+    numTiers = 0;
+    tierSize = minTierSize;
+    size = 0;
+}
+
+template <typename Data>
+inline Data& SetTVec<Data>::At(ulong idx)
+{
+  return tiers[idx / tierSize][idx % tierSize];
+}
+
+template <typename Data>
+inline const Data& SetTVec<Data>::At(ulong idx)
+  const {
+    return tiers[idx / tierSize][idx % tierSize];
+}
+
+// Makes room for a new element at logical index pos: every tier after the
+// target one hands its last element to the front of the next tier, then the
+// target tier shifts its shorter side by one.
+template <typename Data>
+void SetTVec<Data>::OpenGap(ulong pos)
+{
+  if (size == numTiers * tierSize)
+                        AddTier();
+
+  ulong t = pos / tierSize;
+  for (ulong j = numTiers - 1; j > t; --j)
+    tiers[j].PushFront(tiers[j - 1].PopBack());
+
+  Tier& tier = tiers[t];
+  ulong off = pos - t * tierSize;
+  if (off < tier.count - off)
+  {
+    tier.head = (tier.head + tierSize - 1) % tierSize;
+    for (ulong k = 0; k < off; ++k)
+      tier[k] = std::move(tier[k + 1]);
+  }
+  else
+  {
+    for (ulong k = tier.count; k > off; --k)
+      tier[k] = std::move(tier[k - 1]);
+  }
+  tier.count++;
+  size++;
+}
+
+// Removes the element at logical index pos, refilling the target tier with
+// the first element of every following tier.
+template <typename Data>
+void SetTVec<Data>::CloseGap(ulong pos)
+{
+  ulong t = pos / tierSize;
+  Tier& tier = tiers[t];
+  ulong off = pos - t * tierSize;
+  if (off < tier.count - off - 1)
+  {
+    for (ulong k = off; k > 0; --k)
+      tier[k] = std::move(tier[k - 1]);
+    tier.head = (tier.head + 1) % tierSize;
+  }
+  else
+  {
+    for (ulong k = off; k + 1 < tier.count; ++k)
+      tier[k] = std::move(tier[k + 1]);
+  }
+  tier.count--;
+
+  for (ulong j = t + 1; j < numTiers; ++j)
+    tiers[j - 1].PushBack(tiers[j].PopFront());
+
+  if (tiers[numTiers - 1].count == 0)
+                         numTiers--;
+  size--;
+
+  // Halve the tiers once they outnumber the directory by four, keeping
+  // tierSize close to sqrt(n) without rebuilding on every boundary crossing.
+  if (tierSize > minTierSize && numTiers * 4 < tierSize)
+    Rebuild(tierSize / 2);
+}
+
+template <typename Data>
+void SetTVec<Data>::AddTier()
+{
+  if (numTiers >= 2 * tierSize)
+    Rebuild(2 * tierSize);
+
+  if (numTiers == tiers.Size())
+    tiers.Resize(std::max<ulong>(1, 2 * tiers.Size()));
+
+  Tier& tier = tiers[numTiers];
+  if (tier.slots.Size() != tierSize)
+    tier.slots = Vector<Data>(tierSize);
+  tier.head = 0;
+  tier.count = 0;
+  numTiers++;
+}
+
+template <typename Data>
+void SetTVec<Data>::Rebuild(ulong newTierSize)
+{
+  SetTVec<Data> old(std::move(*this));
+
+  tierSize = newTierSize;
+  numTiers = (old.size + tierSize - 1) / tierSize;
+  tiers = Vector<Tier>(std::max<ulong>(1, 2 * numTiers));
+  size = old.size;
+
+  for (ulong t = 0; t < numTiers; ++t)
+  {
+    tiers[t].slots = Vector<Data>(tierSize);
+    tiers[t].count = std::min(tierSize, size - t * tierSize);
+    for (ulong k = 0; k < tiers[t].count; ++k)
+      tiers[t].slots[k] = std::move(old.At(t * tierSize + k));
+  }
+}
+
+template <typename Data>
+inline const Data& SetTVec<Data>::getData(const int& idx)
+  const {
+    return At(idx);
+}
+
+template <typename Data>
+inline int SetTVec<Data>::Reach(int cur, ulong mov, int& predCur)
+  const {
+    cur = cur + mov;
+    predCur = predCur + card(predCur, cur-2);
+  return cur;
+}
+
+template <typename Data>
+inline int SetTVec<Data>::BSearch(const Data& dat)
+  const {
+    int tmp;
+  return Set<Data>::template BSearch<SetTVec<Data>, int>(dat, -1, 0, size, tmp);
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,185 @@
+
+#ifndef SETTVEC_HPP
+#define SETTVEC_HPP
+
+/* ************************************************************************** */
+
+#include "../set.hpp"
+#include "../../vector/vector.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Tiered vector: a directory of circular tiers of tierSize slots each. Every
+// tier but the last one is full, so logical index i lives in tier i/tierSize
+// (O(1) access), while an insertion or removal moves O(tierSize) elements
+// inside one tier and one element per following tier, i.e. O(sqrt(n)).
+
+template <typename Data>
+class SetTVec : virtual public Set<Data> {
+  // Must extend Set<Data>
+
+private:
+
+  // ...
+
+protected:
+
+  using Container::size;
+
+  struct Tier {
+
+    Vector<Data> slots;
+    ulong head = 0;
+    ulong count = 0;
+
+    /* ********************************************************************** */
+
+    // Comparison operators
+    bool operator==(const Tier&) const noexcept;
+    bool operator!=(const Tier&) const noexcept;
+
+    /* ********************************************************************** */
+
+    // Specific member functions
+
+    Data& operator[](ulong); // Logical offset inside the tier (no range check)
+    const Data& operator[](ulong) const;
+
+    void PushFront(Data&&);
+    void PushBack(Data&&);
+    Data PopFront();
+    Data PopBack();
+
+  };
+
+  static const ulong minTierSize;
+  ulong tierSize;
+  ulong numTiers = 0;
+  Vector<Tier> tiers;
+
+public:
+
+  // Default constructor
+  SetTVec();
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  SetTVec(const TraversableContainer<Data>&); // A set obtained from a TraversableContainer
+  SetTVec(MappableContainer<Data>&&); // A set obtained from a MappableContainer
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  SetTVec(const SetTVec<Data>&);
+
+  // Move constructor
+  SetTVec(SetTVec<Data>&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual
+  ~SetTVec() = default;
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  SetTVec<Data>& operator=(const SetTVec<Data>&);
+
+  // Move assignment
+  SetTVec<Data>& operator=(SetTVec<Data>&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const SetTVec<Data>&) const noexcept;
+  bool operator!=(const SetTVec<Data>&) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from OrderedDictionaryContainer)
+
+  const Data& Min() const override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
+  Data MinNRemove() override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
+  void RemoveMin() override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
+
+  const Data& Max() const override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
+  Data MaxNRemove() override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
+  void RemoveMax() override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when empty)
+
+  const Data& Predecessor(const Data&) const override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
+  Data PredecessorNRemove(const Data&) override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
+  void RemovePredecessor(const Data&) override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
+
+  const Data& Successor(const Data&) const override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
+  Data SuccessorNRemove(const Data&) override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
+  void RemoveSuccessor(const Data&) override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
+
+  ulong Rank(const Data&) const noexcept override; // Override OrderedDictionaryContainer member
+  const Data& Select(ulong) const override; // Override OrderedDictionaryContainer member (must throw std::out_of_range when out of range)
+
+  const Data* TryMin() const noexcept override; // Override OrderedDictionaryContainer member
+  const Data* TryMax() const noexcept override; // Override OrderedDictionaryContainer member
+  const Data* TryPredecessor(const Data&) const noexcept override; // Override OrderedDictionaryContainer member
+  const Data* TrySuccessor(const Data&) const noexcept override; // Override OrderedDictionaryContainer member
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from DictionaryContainer)
+
+  bool Insert(const Data&) override; // Override DictionaryContainer member (copy of the value)
+  bool Insert(Data&&) override; // Override DictionaryContainer member (move of the value)
+  bool Remove(const Data&) override; // Override DictionaryContainer member
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from LinearContainer)
+
+  const Data& operator[](ulong) const override; // Override LinearContainer member (must throw std::out_of_range when out of range)
+
+  /* ************************************************************************** */
+
+  // Specific member function (inherited from TestableContainer)
+
+  bool Exists(const Data&) const noexcept override; // Override TestableContainer member
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() noexcept override; // Override ClearableContainer member
+
+protected:
+
+  // Auxiliary functions, if necessary!
+
+  Data& At(ulong);
+  const Data& At(ulong) const;
+  void OpenGap(ulong);
+  void CloseGap(ulong);
+  void AddTier();
+  void Rebuild(ulong);
+  ulong FindPred(const Data&) const;
+  ulong FindSucc(const Data&) const;
+  const Data& getData(const int&) const;
+  int Reach(int, ulong, int&) const;
+  int BSearch(const Data&) const;
+
+  using Set<Data>::card;
+
+  friend class Set<Data>;
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "settvec.cpp"
+
+#endif
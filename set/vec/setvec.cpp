@@ -6,16 +6,26 @@ namespace lasd {
 
 // ...
 
-template <typename Data>
-const ulong SetVec<Data>::initialSize = 10;
+template <typename Data, typename Storage>
+const ulong SetVec<Data, Storage>::initialSize = 10;
 
-template <typename Data>
-SetVec<Data>::SetVec()
-  : Vector<Data>(initialSize), numElements(0) {}
+template <typename Data, typename Storage>
+const ulong SetVec<Data, Storage>::growFactor = 2;
 
-template <typename Data>
-SetVec<Data>::SetVec(const TraversableContainer<Data>& box)
-  : Vector<Data>(box.Size()) {
+template <typename Data, typename Storage>
+const ulong SetVec<Data, Storage>::shrinkDivisor = 4;
+
+template <typename Data, typename Storage>
+SetVec<Data, Storage>::SetVec()
+  : Storage(initialSize), numElements(0) {}
+
+template <typename Data, typename Storage>
+SetVec<Data, Storage>::SetVec(std::pmr::memory_resource& res)
+  : Storage(initialSize, res), numElements(0) {}
+
+template <typename Data, typename Storage>
+SetVec<Data, Storage>::SetVec(const TraversableContainer<Data>& box)
+  : Storage(box.Size()) {
 
   box.Traverse(
     [this](const Data &dat)
@@ -26,9 +36,9 @@ SetVec<Data>::SetVec(const TraversableContainer<Data>& box)
   
 }
 
-template <typename Data>
-SetVec<Data>::SetVec(MappableContainer<Data>&& box)
-  : Vector<Data>(box.Size()) {
+template <typename Data, typename Storage>
+SetVec<Data, Storage>::SetVec(MappableContainer<Data>&& box)
+  : Storage(box.Size()) {
 
   box.Map(
     [this](Data& dat)
@@ -38,39 +48,48 @@ SetVec<Data>::SetVec(MappableContainer<Data>&& box)
   );
 }
 
-template <typename Data>
-SetVec<Data>::SetVec(const SetVec<Data>& other) 
-  : Vector<Data>(other), numElements(other.numElements) {}
+template <typename Data, typename Storage>
+SetVec<Data, Storage>::SetVec(const SetVec<Data, Storage>& other) 
+  : Storage(other.size), numElements(other.numElements), reserved(other.reserved) {
+  for (ulong i = 0; i < numElements; ++i)
+    buffer[i] = other[i];
+}
 
-template <typename Data>
-SetVec<Data>::SetVec(SetVec<Data>&& other)
+template <typename Data, typename Storage>
+SetVec<Data, Storage>::SetVec(SetVec<Data, Storage>&& other)
   noexcept {
     *this = std::move(other);
 }
 
-template <typename Data>
-SetVec<Data>& SetVec<Data>::operator=(const SetVec<Data>& other)
+template <typename Data, typename Storage>
+SetVec<Data, Storage>& SetVec<Data, Storage>::operator=(const SetVec<Data, Storage>& other)
 {
 
   if (this == &other) return *this;
 
-  SetVec<Data>&& tmp = SetVec(other);
+  SetVec<Data, Storage>&& tmp = SetVec(other);
   std::swap(tmp, *this);
 
   return *this;
 }
 
-template <typename Data>
-SetVec<Data>& SetVec<Data>::operator=(SetVec<Data>&& other)
+template <typename Data, typename Storage>
+SetVec<Data, Storage>& SetVec<Data, Storage>::operator=(SetVec<Data, Storage>&& other)
   noexcept {
-    this->Vector<Data>::operator= (std::move(other));
+    // The storages are swapped through a third one, as a storage move need not
+    // be a swap (SmallVector moves inline elements across and leaves the
+    // source empty)
+    Storage mine(std::move(static_cast<Storage&>(*this)));
+    static_cast<Storage&>(*this) = std::move(static_cast<Storage&>(other));
+    static_cast<Storage&>(other) = std::move(mine);
     std::swap(other.numElements, numElements);
     std::swap(other.head, head);
+    std::swap(other.reserved, reserved);
   return *this;
 }
 
-template <typename Data>
-inline bool SetVec<Data>::operator==(const SetVec<Data>& other)
+template <typename Data, typename Storage>
+inline bool SetVec<Data, Storage>::operator==(const SetVec<Data, Storage>& other)
   const noexcept {
     if (numElements != other.numElements)
       return false;
@@ -82,44 +101,44 @@ inline bool SetVec<Data>::operator==(const SetVec<Data>& other)
   return diffAbsence;
 }
 
-template <typename Data>
-inline bool SetVec<Data>::operator!=(const SetVec<Data>& other) const noexcept {
+template <typename Data, typename Storage>
+inline bool SetVec<Data, Storage>::operator!=(const SetVec<Data, Storage>& other) const noexcept {
   return !(*this == other);
 }
 
-template <typename Data>
-inline const Data& SetVec<Data>::Min()
+template <typename Data, typename Storage>
+inline const Data& SetVec<Data, Storage>::Min()
   const {
     if (Empty()) throw std::length_error("Set is empty");
   return (*this)[0];
 }
 
-template <typename Data>
-inline Data SetVec<Data>::MinNRemove() {
+template <typename Data, typename Storage>
+inline Data SetVec<Data, Storage>::MinNRemove() {
   if (Empty()) throw std::length_error("Set is empty"); // #TODO corrected: -> if(Empty()) throw std::length_error("SetVec is empty");
-  Data& ret = (*this)[0];
+  Data ret = std::move((*this)[0]);
   RemoveMin();
   return ret;
 }
 
-template <typename Data>
-inline void SetVec<Data>::RemoveMin() {
+template <typename Data, typename Storage>
+inline void SetVec<Data, Storage>::RemoveMin() {
   if (numElements == 0) {
     throw std::length_error("SetVec is empty");
   }
   Shift(0,-1);
-  EnsureCapacity(numElements);
+  ShrinkIfSparse();
 }
 
-template <typename Data>
-inline const Data& SetVec<Data>::Max()
+template <typename Data, typename Storage>
+inline const Data& SetVec<Data, Storage>::Max()
   const {
     if (Empty()) throw std::length_error("Set is empty");
     return (*this)[numElements - 1];
 }
 
-template <typename Data>
-inline Data SetVec<Data>::MaxNRemove() 
+template <typename Data, typename Storage>
+inline Data SetVec<Data, Storage>::MaxNRemove() 
 {
   if (Empty()) throw std::length_error("Set is empty"); // #TODO corrected: -> if(Empty()) throw std::length_error("SetVec is empty");
   Data ret = (*this)[numElements - 1];
@@ -127,18 +146,18 @@ inline Data SetVec<Data>::MaxNRemove()
   return std::move(ret);
 }
 
-template <typename Data>
-inline void SetVec<Data>::RemoveMax()
+template <typename Data, typename Storage>
+inline void SetVec<Data, Storage>::RemoveMax()
 {
   if (numElements == 0) {
     throw std::length_error("Vector is empty");
   }
   Shift(numElements-1,-1);
-  EnsureCapacity(numElements);
+  ShrinkIfSparse();
 }
 
-template <typename Data>
-inline ulong SetVec<Data>::FindPred(const Data& dat)
+template <typename Data, typename Storage>
+inline ulong SetVec<Data, Storage>::FindPred(const Data& dat)
 {
   int idx = BSearch(dat);
   if (idx == -1 || (*this)[idx] == dat)
@@ -149,32 +168,32 @@ inline ulong SetVec<Data>::FindPred(const Data& dat)
   return idx;
 }
 
-template <typename Data>
-inline const Data& SetVec<Data>::Predecessor(const Data& dat) const {
+template <typename Data, typename Storage>
+inline const Data& SetVec<Data, Storage>::Predecessor(const Data& dat) const {
 
-  return (*this)[const_cast<SetVec<Data>*>(this)->FindPred(dat)];
+  return (*this)[const_cast<SetVec<Data, Storage>*>(this)->FindPred(dat)];
 }
 
-template <typename Data>
-inline Data SetVec<Data>::PredecessorNRemove(const Data& dat) {
+template <typename Data, typename Storage>
+inline Data SetVec<Data, Storage>::PredecessorNRemove(const Data& dat) {
   
   ulong idx = FindPred(dat);
 
   Data pred = std::move((*this)[idx]);
   Shift(idx, -1);
-  EnsureCapacity(numElements);
+  ShrinkIfSparse();
 
   return pred;
 }
 
-template <typename Data>
-inline void SetVec<Data>::RemovePredecessor(const Data& dat) {
+template <typename Data, typename Storage>
+inline void SetVec<Data, Storage>::RemovePredecessor(const Data& dat) {
   Shift(FindPred(dat), -1);
-  EnsureCapacity(numElements);
+  ShrinkIfSparse();
 }
 
-template <typename Data>
-inline ulong SetVec<Data>::FindSucc(const Data& dat)
+template <typename Data, typename Storage>
+inline ulong SetVec<Data, Storage>::FindSucc(const Data& dat)
 {
   int idx = BSearch(dat);
   idx++;
@@ -184,32 +203,79 @@ inline ulong SetVec<Data>::FindSucc(const Data& dat)
   return idx;
 }
 
-template <typename Data>
-inline const Data& SetVec<Data>::Successor(const Data& dat)
+template <typename Data, typename Storage>
+inline const Data& SetVec<Data, Storage>::Successor(const Data& dat)
   const {
-    return (*this)[const_cast<SetVec<Data>*>(this)->FindSucc(dat)];
+    return (*this)[const_cast<SetVec<Data, Storage>*>(this)->FindSucc(dat)];
 }
 
-template <typename Data>
-inline Data SetVec<Data>::SuccessorNRemove(const Data& dat) {
+template <typename Data, typename Storage>
+inline Data SetVec<Data, Storage>::SuccessorNRemove(const Data& dat) {
   
   ulong idx = FindSucc(dat);
 
   Data ret = std::move((*this)[idx]);
   Shift(idx, -1);
-  EnsureCapacity(numElements);
+  ShrinkIfSparse();
 
   return ret;
 }
 
-template <typename Data>
-inline void SetVec<Data>::RemoveSuccessor(const Data& dat) {
+template <typename Data, typename Storage>
+inline void SetVec<Data, Storage>::RemoveSuccessor(const Data& dat) {
   Shift(FindSucc(dat), -1);
-  EnsureCapacity(numElements);
+  ShrinkIfSparse();
+}
+
+template <typename Data, typename Storage>
+inline ulong SetVec<Data, Storage>::Rank(const Data& dat)
+  const noexcept {
+    int idx = BSearch(dat);
+    if (idx == -1)
+            return 0;
+    return ((*this)[idx] == dat) ? idx : idx + 1;
+}
+
+template <typename Data, typename Storage>
+inline const Data& SetVec<Data, Storage>::Select(ulong k)
+  const {
+    return (*this)[k]; // O(1): logical index k lives at buffer[(head + k) % size]
+}
+
+template <typename Data, typename Storage>
+inline const Data* SetVec<Data, Storage>::TryMin()
+  const noexcept {
+    if (numElements == 0)
+                return nullptr;
+    return &buffer[head];
 }
 
-template <typename Data>
-bool SetVec<Data>::Insert(const Data& dat) {
+template <typename Data, typename Storage>
+inline const Data* SetVec<Data, Storage>::TryMax()
+  const noexcept {
+    if (numElements == 0)
+                return nullptr;
+    return &buffer[mod(head + numElements - 1, size)];
+}
+
+template <typename Data, typename Storage>
+inline const Data* SetVec<Data, Storage>::TryPredecessor(const Data& dat)
+  const noexcept {
+    int idx = BSearch(dat);
+    if (idx != -1 && (*this)[idx] == dat)
+                                  idx--;
+    return (idx < 0) ? nullptr : &(*this)[idx];
+}
+
+template <typename Data, typename Storage>
+inline const Data* SetVec<Data, Storage>::TrySuccessor(const Data& dat)
+  const noexcept {
+    int idx = BSearch(dat) + 1;
+    return (idx >= static_cast<int>(numElements)) ? nullptr : &(*this)[idx];
+}
+
+template <typename Data, typename Storage>
+bool SetVec<Data, Storage>::Insert(const Data& dat) {
   /*
   int foundIndex = BSearch(dat);
 
@@ -229,8 +295,8 @@ bool SetVec<Data>::Insert(const Data& dat) {
   return AttachWithIn(dat, numElements + 1);
 }
 
-template <typename Data>
-bool SetVec<Data>::AttachWithIn(const Data& dat, ulong dim)
+template <typename Data, typename Storage>
+bool SetVec<Data, Storage>::AttachWithIn(const Data& dat, ulong dim)
 {
   int foundIndex = BSearch(dat);
 
@@ -247,8 +313,8 @@ bool SetVec<Data>::AttachWithIn(const Data& dat, ulong dim)
   return true;
 }
 
-template <typename Data>
-bool SetVec<Data>::AttachWithIn(Data&& dat, ulong dim)
+template <typename Data, typename Storage>
+bool SetVec<Data, Storage>::AttachWithIn(Data&& dat, ulong dim)
 {
   int foundIndex = BSearch(dat);
 
@@ -265,8 +331,8 @@ bool SetVec<Data>::AttachWithIn(Data&& dat, ulong dim)
   return true;
 }
 
-template <typename Data>
-bool SetVec<Data>::Insert(Data&& dat) {
+template <typename Data, typename Storage>
+bool SetVec<Data, Storage>::Insert(Data&& dat) {
   /*
     int foundIndex = BSearch(dat);
 
@@ -285,56 +351,60 @@ bool SetVec<Data>::Insert(Data&& dat) {
   return AttachWithIn(std::move(dat), numElements + 1);
 }
 
-template <typename Data>
-bool SetVec<Data>::InsertAll(const TraversableContainer<Data>& box) {
+template <typename Data, typename Storage>
+bool SetVec<Data, Storage>::InsertAll(const TraversableContainer<Data>& box) {
   bool check = true;
+  EnsureCapacity(numElements + box.Size());
   box.Traverse(
-    [this, &box, &check](const Data&dat)
+    [this, &check](const Data&dat)
     {
-      check = (AttachWithIn(dat, box.Size()) && check);
+      check = (AttachWithIn(dat, numElements + 1) && check);
     }
   );
   return check;
 }
 
-template <typename Data>
-bool SetVec<Data>::InsertAll(MappableContainer<Data>&& box) {
+template <typename Data, typename Storage>
+bool SetVec<Data, Storage>::InsertAll(MappableContainer<Data>&& box) {
   bool check = true;
+  EnsureCapacity(numElements + box.Size());
   box.Map(
-    [this, &box, &check](Data& dat)
+    [this, &check](Data& dat)
     {
-      check = (AttachWithIn(std::move(dat), box.Size()) && check);
+      check = (AttachWithIn(std::move(dat), numElements + 1) && check);
     }
   );
   return check;
 }
 
-template <typename Data>
-bool SetVec<Data>::InsertSome(const TraversableContainer<Data>& box) {
+template <typename Data, typename Storage>
+bool SetVec<Data, Storage>::InsertSome(const TraversableContainer<Data>& box) {
   bool check = false;
+  EnsureCapacity(numElements + box.Size());
   box.Traverse(
-    [this, &box, &check](const Data& dat)
+    [this, &check](const Data& dat)
     {
-      check = (AttachWithIn(dat, box.Size()) || check);
+      check = (AttachWithIn(dat, numElements + 1) || check);
     }
   );
   return check;
 }
 
-template <typename Data>
-bool SetVec<Data>::InsertSome(MappableContainer<Data>&& box) {
+template <typename Data, typename Storage>
+bool SetVec<Data, Storage>::InsertSome(MappableContainer<Data>&& box) {
   bool check = false;
+  EnsureCapacity(numElements + box.Size());
   box.Map(
-    [this, &box, &check](Data& dat)
+    [this, &check](Data& dat)
     {
-      check = (AttachWithIn(std::move(dat), box.Size()) || check);
+      check = (AttachWithIn(std::move(dat), numElements + 1) || check);
     }
   );
   return check;
 }
 
-template <typename Data>
-bool SetVec<Data>::Remove(const Data& data) {
+template <typename Data, typename Storage>
+bool SetVec<Data, Storage>::Remove(const Data& data) {
 
   int foundIndex = BSearch(data);
 
@@ -342,24 +412,24 @@ bool SetVec<Data>::Remove(const Data& data) {
                                          return false;
 
   Shift(foundIndex, -1);
-  EnsureCapacity(numElements);
+  ShrinkIfSparse();
 
   return true;
 
 }
 
-template <typename Data>
-const Data& SetVec<Data>::operator[](ulong idx)
+template <typename Data, typename Storage>
+const Data& SetVec<Data, Storage>::operator[](ulong idx)
   const {
     
     if (idx >= numElements) 
       throw std::out_of_range("Index out of range");
     
-    return Vector<Data>::operator[](mod(idx + head, size));
+    return Storage::operator[](mod(idx + head, size));
 }
 
-template <typename Data>
-inline bool SetVec<Data>::Exists(const Data& data) const noexcept{
+template <typename Data, typename Storage>
+inline bool SetVec<Data, Storage>::Exists(const Data& data) const noexcept{
   bool itExists = false;
   int foundIndex = BSearch(data);
   if (foundIndex != -1 && (*this)[foundIndex] == data)
@@ -367,30 +437,31 @@ inline bool SetVec<Data>::Exists(const Data& data) const noexcept{
   return itExists;
 }
 
-template <typename Data>
-void SetVec<Data>::Clear() 
+template <typename Data, typename Storage>
+void SetVec<Data, Storage>::Clear() 
   noexcept {
 
     if (size==0)
          return;
     
-    numElements = 1;
-    RemoveMin();
+    numElements = 0;
+    head = 0;
+    Resize(std::max(initialSize, reserved));
 }
 
-template <typename Data>
-inline bool SetVec<Data>::Empty() const noexcept {
+template <typename Data, typename Storage>
+inline bool SetVec<Data, Storage>::Empty() const noexcept {
   return (numElements == 0);
 }
 
-template <typename Data>
-ulong SetVec<Data>::Size()
+template <typename Data, typename Storage>
+ulong SetVec<Data, Storage>::Size()
   const noexcept {
     return numElements;
 }
 
-template <typename Data>
-void SetVec<Data>::Traverse(typename TraversableContainer<Data>::TraverseFun f)
+template <typename Data, typename Storage>
+void SetVec<Data, Storage>::Traverse(typename TraversableContainer<Data>::TraverseFun f)
   const {
     for (ulong i = 0; i < numElements; ++i)
     {
@@ -398,8 +469,8 @@ void SetVec<Data>::Traverse(typename TraversableContainer<Data>::TraverseFun f)
     }
 }
 
-template <typename Data>
-void SetVec<Data>::PreOrderTraverse(typename TraversableContainer<Data>::TraverseFun f)
+template <typename Data, typename Storage>
+void SetVec<Data, Storage>::PreOrderTraverse(typename TraversableContainer<Data>::TraverseFun f)
   const {
     for (ulong i = 0; i < numElements; ++i)
     {
@@ -407,8 +478,8 @@ void SetVec<Data>::PreOrderTraverse(typename TraversableContainer<Data>::Travers
     }
 }
 
-template <typename Data>
-void SetVec<Data>::PostOrderTraverse(typename TraversableContainer<Data>::TraverseFun f)
+template <typename Data, typename Storage>
+void SetVec<Data, Storage>::PostOrderTraverse(typename TraversableContainer<Data>::TraverseFun f)
   const {
     for (ulong i = numElements; i > 0; --i)
     {
@@ -416,70 +487,109 @@ void SetVec<Data>::PostOrderTraverse(typename TraversableContainer<Data>::Traver
     }
 }
 
-template <typename Data>
-Data& SetVec<Data>::operator[](ulong idx)
+template <typename Data, typename Storage>
+Data& SetVec<Data, Storage>::operator[](ulong idx)
 {
     
   if (idx >= numElements) 
     throw std::out_of_range("Index out of range");
   
-  return Vector<Data>::operator[](mod(idx + head, size));
+  return Storage::operator[](mod(idx + head, size));
 }
 
-template <typename Data>
-inline const Data& SetVec<Data>::Front() const {
+template <typename Data, typename Storage>
+inline const Data& SetVec<Data, Storage>::Front() const {
   if (numElements == 0) throw std::length_error("Set is empty");
   return (*this)[0];
 }
 
-template <typename Data>
-inline const Data& SetVec<Data>::Back() const {
+template <typename Data, typename Storage>
+inline const Data& SetVec<Data, Storage>::Back() const {
   if (numElements == 0) throw std::length_error("Set is empty");
   return (*this)[numElements - 1];
 }
 
-template <typename Data>
-void SetVec<Data>::EnsureCapacity(ulong dim)
+// Inserts only ever grow the buffer: a batch insert reserves room for the
+// whole batch up front and the per-element inserts must not give it back.
+template <typename Data, typename Storage>
+void SetVec<Data, Storage>::EnsureCapacity(ulong dim)
 {
-  float resizingFactor = 1.5;
-  
-  if (size < dim) { // | | | | | -> | | | | | | | 
-    
-    if (Empty()) {
-      Resize(initialSize);
-      return;
-    }
-    Resize(static_cast<ulong>(std::ceil(resizingFactor*size))); // #TODO corrected: resizingFactor*size -> std::ceil(resizingFactor*size)
-    return;
+  ulong needed = std::max(dim, numElements);
+
+  if (size < needed) { // | | | | | -> | | | | | | | | | |
+    ulong newSize = std::max(size, initialSize);
+    while (newSize < needed)
+      newSize *= growFactor;
+    Resize(newSize);
   }
+}
 
-  if (numElements < std::ceil(resizingFactor))
-                                       return;
+// Shrinking halves the buffer only once it is a quarter full, so the
+// occupancy after a shrink is still far from both thresholds and an
+// insert/remove ping-pong never reallocates.
+template <typename Data, typename Storage>
+void SetVec<Data, Storage>::ShrinkIfSparse()
+{
+  // |x|x| | | | | | | -> |x|x| | |
+  ulong floor = std::max(initialSize, reserved);
+  if (size > floor && numElements * shrinkDivisor <= size)
+    Resize(std::max(floor, size / growFactor));
+}
 
-  // |x|x|x|x| | | | | | -> |x|x|x|x| | |
-  if (size > static_cast<ulong>(numElements*resizingFactor*resizingFactor))          
-     Resize(static_cast<ulong>(numElements*resizingFactor));
+template <typename Data, typename Storage>
+inline ulong SetVec<Data, Storage>::Capacity()
+  const noexcept {
+    return size;
 }
 
-template <typename Data>
-void SetVec<Data>::Resize(ulong newSize)
+template <typename Data, typename Storage>
+void SetVec<Data, Storage>::Reserve(ulong dim)
 {
+  reserved = dim;
+  if (size < dim)
+    Resize(dim);
+}
 
-  if (newSize == 0) {
-    this->Vector<Data>::Clear();
-  }
+template <typename Data, typename Storage>
+void SetVec<Data, Storage>::ShrinkToFit()
+{
+  reserved = 0;
+  if (size != numElements)
+    Resize(numElements);
+}
 
-  SetVec<Data> oldSet(std::move(*this));
-  this->buffer = new Data[newSize];
-  this->size = newSize;
-  numElements = oldSet.numElements;
+// The elements move across in order, so the new buffer starts at head 0.
+template <typename Data, typename Storage>
+void SetVec<Data, Storage>::Resize(ulong newSize)
+{
+  Storage fresh = NewStorage(newSize);
+  for (ulong i = 0; i < numElements; ++i)
+    fresh[i] = std::move((*this)[i]);
+  Storage::operator=(std::move(fresh));
   head = 0;
+}
 
-  oldSet.Transfer(*this, 0, oldSet.numElements, 0);
+template <typename Data, typename Storage>
+Storage SetVec<Data, Storage>::NewStorage(ulong dim) const
+{
+  if constexpr (std::is_base_of_v<Vector<Data>, Storage>) {
+    if (Resource() != nullptr)
+      return Storage(dim, *Resource());
+  }
+  return Storage(dim);
+}
+
+template <typename Data, typename Storage>
+inline std::pmr::memory_resource* SetVec<Data, Storage>::Resource()
+  const noexcept {
+    if constexpr (std::is_base_of_v<Vector<Data>, Storage>)
+      return Storage::Resource();
+    else
+      return nullptr;
 }
 
-template <typename Data>
-void SetVec<Data>::Transfer(SetVec<Data> &receiver, ulong srcStart, int grouping, ulong dstStart)
+template <typename Data, typename Storage>
+void SetVec<Data, Storage>::Transfer(SetVec<Data, Storage> &receiver, ulong srcStart, int grouping, ulong dstStart)
 {
 
   // if (std::abs(grouping) > std::min(numElements, receiver.numElements))
@@ -503,19 +613,36 @@ void SetVec<Data>::Transfer(SetVec<Data> &receiver, ulong srcStart, int grouping
   //   throw std::length_error("Index bigger than last element's index");
   // }
 
-  this->Vector<Data>::Transfer(receiver, srcStart, grouping, dstStart);
+  if (std::abs(grouping) > std::min(Size(), receiver.Size()))
+    throw std::invalid_argument("non valid grouping");
+
+  int sign = (grouping < 0) ? -1 : 1;
+
+  ulong srcIndex, dstIndex;
+  for (int i = grouping; std::abs(i) > 0; i=sign*(std::abs(i)-1)) {
+
+    srcIndex=mod(srcStart+i-sign, Size());
+    dstIndex=mod(dstStart+i-sign, receiver.Size());
+
+    receiver[dstIndex] = std::move((*this)[srcIndex]);
+  }
+}
+
+template <typename Data, typename Storage>
+inline ulong SetVec<Data, Storage>::mod(int x, int m) {
+  return static_cast<ulong>(((x%m) + m)%m);
 }
 
-template <typename Data>
-inline bool SetVec<Data>::isLefter(int idx)
+template <typename Data, typename Storage>
+inline bool SetVec<Data, Storage>::isLefter(int idx)
 {
   if (idx >= static_cast<int>(numElements))
     throw std::out_of_range("Index bigger than last element's index");
   return (static_cast<int>(idx) < (static_cast<int>(numElements-(idx + 1))));
 }
 
-template <typename Data>
-void SetVec<Data>::Shift(int idx, int dim)
+template <typename Data, typename Storage>
+void SetVec<Data, Storage>::Shift(int idx, int dim)
 {
 
   if (dim == 0)
@@ -560,25 +687,25 @@ void SetVec<Data>::Shift(int idx, int dim)
   return;
 }
 
-template <typename Data>
-inline const Data& SetVec<Data>::getData(const int& idx) 
+template <typename Data, typename Storage>
+inline const Data& SetVec<Data, Storage>::getData(const int& idx) 
   const {
     return (*this)[idx];
 }
 
-template <typename Data>
-inline int SetVec<Data>::Reach(int cur, ulong mov, int &predCur) 
+template <typename Data, typename Storage>
+inline int SetVec<Data, Storage>::Reach(int cur, ulong mov, int &predCur) 
   const {
     cur = cur + mov;
     predCur = predCur + card(predCur, cur-2);
   return cur;
 }
 
-template <typename Data>
-inline int SetVec<Data>::BSearch(const Data &dat)
+template <typename Data, typename Storage>
+inline int SetVec<Data, Storage>::BSearch(const Data &dat)
   const {
     int tmp;
-  return Set<Data>::template BSearch<SetVec<Data>, int>(dat, -1, 0, numElements, tmp);
+  return Set<Data>::template BSearch<SetVec<Data, Storage>, int>(dat, -1, 0, numElements, tmp);
 }
 
 /* ************************************************************************** */
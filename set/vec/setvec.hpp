@@ -4,6 +4,10 @@
 
 /* ************************************************************************** */
 
+#include <type_traits>
+
+/* ************************************************************************** */
+
 #include "../set.hpp"
 #include "../../vector/vector.hpp"
 
@@ -13,8 +17,13 @@ namespace lasd {
 
 /* ************************************************************************** */
 
-template <typename Data>
-class SetVec : virtual public Set<Data>, virtual protected Vector<Data> {
+// Storage is the buffer the sorted elements live in, as a circular array:
+// Vector<Data> by default, or SmallVector<Data, N> to keep sets of up to N
+// elements off the heap. Any MutableLinearContainer and ResizableContainer
+// with a buffer pointer and Vector's constructors will do.
+
+template <typename Data, typename Storage = Vector<Data>>
+class SetVec : virtual public Set<Data>, virtual protected Storage {
   // Must extend Set<Data>,
   //             ResizableContainer
 
@@ -25,10 +34,13 @@ private:
 protected:
 
   static const ulong initialSize;
+  static const ulong growFactor; // Capacity multiplier when the buffer is full
+  static const ulong shrinkDivisor; // Shrink once occupancy drops to 1/shrinkDivisor
   using Container::size;
-  using Vector<Data>::buffer;
+  using Storage::buffer;
   ulong head = 0;
   ulong numElements = 0;
+  ulong reserved = 0; // Capacity floor requested through Reserve
 
   // ...
 
@@ -42,14 +54,15 @@ public:
   // Specific constructors
   SetVec(const TraversableContainer<Data>&); // A set obtained from a TraversableContainer
   SetVec(MappableContainer<Data>&&); // A set obtained from a MappableContainer
+  explicit SetVec(std::pmr::memory_resource&); // An empty set allocating from the given memory resource (Vector storage only)
 
   /* ************************************************************************ */
 
   // Copy constructor
-  SetVec(const SetVec<Data>&);
+  SetVec(const SetVec<Data, Storage>&);
 
   // Move constructor
-  SetVec(SetVec<Data>&&) noexcept;
+  SetVec(SetVec<Data, Storage>&&) noexcept;
 
   /* ************************************************************************ */
 
@@ -60,16 +73,16 @@ public:
   /* ************************************************************************ */
 
   // Copy assignment
-  SetVec<Data>& operator=(const SetVec<Data>&);
+  SetVec<Data, Storage>& operator=(const SetVec<Data, Storage>&);
 
   // Move assignment
-  SetVec<Data>& operator=(SetVec<Data>&&) noexcept;
+  SetVec<Data, Storage>& operator=(SetVec<Data, Storage>&&) noexcept;
 
   /* ************************************************************************ */
 
   // Comparison operators
-  bool operator==(const SetVec<Data>&) const noexcept;
-  bool operator!=(const SetVec<Data>&) const noexcept; 
+  bool operator==(const SetVec<Data, Storage>&) const noexcept;
+  bool operator!=(const SetVec<Data, Storage>&) const noexcept; 
 
   /* ************************************************************************ */
 
@@ -90,6 +103,14 @@ public:
   const Data& Successor(const Data&) const override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
   Data SuccessorNRemove(const Data&) override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
   void RemoveSuccessor(const Data&) override; // Override OrderedDictionaryContainer member (concrete function must throw std::length_error when not found)
+
+  ulong Rank(const Data&) const noexcept override; // Override OrderedDictionaryContainer member
+  const Data& Select(ulong) const override; // Override OrderedDictionaryContainer member (must throw std::out_of_range when out of range)
+
+  const Data* TryMin() const noexcept override; // Override OrderedDictionaryContainer member
+  const Data* TryMax() const noexcept override; // Override OrderedDictionaryContainer member
+  const Data* TryPredecessor(const Data&) const noexcept override; // Override OrderedDictionaryContainer member
+  const Data* TrySuccessor(const Data&) const noexcept override; // Override OrderedDictionaryContainer member
   
   /* ************************************************************************ */
 
@@ -127,6 +148,10 @@ public:
   bool Empty() const noexcept override; // Override ClearableContainer member
 
   ulong Size() const noexcept override;
+
+  ulong Capacity() const noexcept;
+  void Reserve(ulong); // Capacity never drops below the given one until ShrinkToFit
+  void ShrinkToFit();
   
   void Traverse(typename TraversableContainer<Data>::TraverseFun) const override;
 
@@ -138,6 +163,8 @@ public:
 
   const Data& Back() const override;
 
+  std::pmr::memory_resource* Resource() const noexcept; // The resource of a Vector storage (nullptr for any other)
+
 protected:
 
   // Auxiliary functions, if necessary!
@@ -145,16 +172,18 @@ protected:
   Data &operator[](ulong idx) override;
   ulong FindPred(const Data&);
   ulong FindSucc(const Data&);
-  void EnsureCapacity(ulong) override;
+  void EnsureCapacity(ulong); // Grows only, see ShrinkIfSparse
+  void ShrinkIfSparse(); // Called by the remove paths
   void Resize(ulong) override;
-  void Transfer(SetVec<Data> &receiver, ulong srcStart, int grouping, ulong dstStart);
+  Storage NewStorage(ulong) const; // A storage of the given size, from the same resource
+  void Transfer(SetVec<Data, Storage> &receiver, ulong srcStart, int grouping, ulong dstStart);
   bool isLefter(int);
   void Shift(int, int);
   const Data& getData(const int&) const;
   int Reach(int, ulong, int&) const;
   int BSearch(const Data&) const;
 
-  using Vector<Data>::mod;
+  static ulong mod(int, int);
   using Set<Data>::card;
 
   friend class Set<Data>;
@@ -0,0 +1,76 @@
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// ...
+
+inline AlignedResource::AlignedResource(ulong alignment, ulong hugeThreshold)
+  : alignment(alignment), hugeThreshold(hugeThreshold) {
+  if (alignment < cacheLine || (alignment & (alignment - 1)) != 0) {
+    throw std::invalid_argument("Alignment must be a power of two of at least a cache line");
+  }
+}
+
+/* ************************************************************************** */
+
+inline ulong AlignedResource::Alignment() const noexcept {
+  return alignment;
+}
+
+inline ulong AlignedResource::HugeThreshold() const noexcept {
+  return hugeThreshold;
+}
+
+inline bool AlignedResource::HugePagesHinted() noexcept {
+#if defined(MADV_HUGEPAGE)
+  return true;
+#else
+  return false;
+#endif
+}
+
+/* ************************************************************************** */
+
+// A huge allocation starts on a huge page boundary and fills whole huge
+// pages, so that madvise covers all of it and no small page is shared with
+// another allocation.
+inline void* AlignedResource::do_allocate(std::size_t bytes, std::size_t align) {
+  std::size_t al = AlignmentFor(bytes, align);
+  if (!Huge(bytes))
+    return ::operator new(bytes, std::align_val_t(al));
+  std::size_t rounded = (bytes + hugePage - 1) / hugePage * hugePage;
+  void* ptr = ::operator new(rounded, std::align_val_t(al));
+#if defined(MADV_HUGEPAGE)
+  madvise(ptr, rounded, MADV_HUGEPAGE);
+#endif
+  return ptr;
+}
+
+inline void AlignedResource::do_deallocate(void* ptr, std::size_t bytes, std::size_t align) {
+  ::operator delete(ptr, std::align_val_t(AlignmentFor(bytes, align)));
+}
+
+inline bool AlignedResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+  const AlignedResource* same = dynamic_cast<const AlignedResource*>(&other);
+  return same != nullptr && same->alignment == alignment && same->hugeThreshold == hugeThreshold;
+}
+
+/* ************************************************************************** */
+
+inline bool AlignedResource::Huge(std::size_t bytes) const noexcept {
+  return hugeThreshold > 0 && bytes >= hugeThreshold;
+}
+
+inline std::size_t AlignedResource::AlignmentFor(std::size_t bytes, std::size_t align) const noexcept {
+  std::size_t al = std::max<std::size_t>(align, alignment);
+  return Huge(bytes) ? std::max<std::size_t>(al, hugePage) : al;
+}
+
+/* ************************************************************************** */
+
+}
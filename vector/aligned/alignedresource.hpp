@@ -0,0 +1,101 @@
+
+#ifndef ALIGNEDRESOURCE_HPP
+#define ALIGNEDRESOURCE_HPP
+
+/* ************************************************************************** */
+
+#include <algorithm>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+
+/* ************************************************************************** */
+
+#include "../../container/container.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Memory resource handing out buffers aligned to a cache line or more, for a
+// Vector (or any container taking a resource) whose scans should start on a
+// line boundary and suit aligned vector loads. Allocations of at least a given
+// size are further aligned and rounded up to whole huge pages, and the kernel
+// is advised to back them with transparent huge pages, so that a very large
+// buffer needs a fraction of the TLB entries. The hint is only a hint: where
+// it is not available, or huge pages are disabled, the buffer is still
+// aligned and otherwise ordinary.
+
+class AlignedResource : public std::pmr::memory_resource {
+
+private:
+
+  // ...
+
+protected:
+
+  ulong alignment = cacheLine;
+  ulong hugeThreshold = 0; // Smallest allocation hinted for huge pages (0: none)
+
+public:
+
+  static const ulong cacheLine = 64;
+  static const ulong hugePage = 2 * 1024 * 1024;
+
+  // Default constructor
+  AlignedResource() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  explicit AlignedResource(ulong, ulong = 0); // Alignment, and smallest allocation hinted for huge pages (must throw std::invalid_argument when the alignment is not a power of two of at least a cache line)
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  AlignedResource(const AlignedResource&) = default;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual
+  ~AlignedResource() = default;
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  AlignedResource& operator=(const AlignedResource&) = default;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  ulong Alignment() const noexcept;
+  ulong HugeThreshold() const noexcept;
+
+  static bool HugePagesHinted() noexcept; // Whether this build can advise huge pages at all
+
+protected:
+
+  // Specific member functions (inherited from memory_resource)
+
+  void* do_allocate(std::size_t, std::size_t) override; // Override memory_resource member
+  void do_deallocate(void*, std::size_t, std::size_t) override; // Override memory_resource member
+  bool do_is_equal(const std::pmr::memory_resource&) const noexcept override; // Override memory_resource member
+
+  // Auxiliary functions, if necessary!
+
+  bool Huge(std::size_t) const noexcept;
+  std::size_t AlignmentFor(std::size_t, std::size_t) const noexcept;
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "alignedresource.cpp"
+
+#endif
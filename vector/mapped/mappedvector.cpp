@@ -0,0 +1,269 @@
+
+#include <algorithm>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// ...
+
+template <typename Data>
+MappedVector<Data>::MappedVector(const std::filesystem::path& path, MapMode mode, ulong tag)
+  : path(path), mode(mode), tag(tag) {
+  size = 0;
+  file = ::open(path.c_str(), (mode == MapMode::ReadWrite) ? (O_RDWR | O_CREAT) : O_RDONLY, 0644);
+  if (file < 0) {
+    throw std::runtime_error("Cannot open " + path.string());
+  }
+  struct stat info;
+  if (::fstat(file, &info) != 0)
+    Fail("Cannot inspect " + path.string());
+  ulong length = static_cast<ulong>(info.st_size);
+  if (length == 0 && mode == MapMode::ReadWrite) {
+    Header fresh;
+    Stamp(&fresh);
+    if (::ftruncate(file, dataOffset) != 0 || ::pwrite(file, &fresh, sizeof(Header), 0) != static_cast<ssize_t>(sizeof(Header)))
+      Fail("Cannot initialise " + path.string());
+    length = dataOffset;
+  }
+  if (length < dataOffset)
+    Fail(path.string() + " holds no vector");
+
+  int prot = (mode == MapMode::ReadOnly) ? PROT_READ : (PROT_READ | PROT_WRITE);
+  int flags = (mode == MapMode::CopyOnWrite) ? MAP_PRIVATE : MAP_SHARED;
+  capacity = (length - dataOffset) / sizeof(Data);
+  map = ::mmap(nullptr, Bytes(capacity), prot, flags, file, 0);
+  if (map == MAP_FAILED) {
+    map = nullptr;
+    Fail("Cannot map " + path.string());
+  }
+
+  const Header* head = Head();
+  if (std::memcmp(head->magic, magic, sizeof(magic)) != 0)
+    Fail(path.string() + " holds no vector");
+  if (head->elementSize != sizeof(Data) || head->tag != tag)
+    Fail(path.string() + " holds a vector of other records");
+  if (head->size > capacity)
+    Fail(path.string() + " is truncated");
+  size = head->size;
+}
+
+template <typename Data>
+MappedVector<Data>::~MappedVector() {
+  Unmap();
+  if (file >= 0)
+    ::close(file);
+}
+
+/* ************************************************************************** */
+
+template <typename Data>
+inline bool MappedVector<Data>::operator==(const MappedVector<Data>& other)
+  const noexcept {
+    return LinearContainer<Data>::operator==(other);
+}
+
+template <typename Data>
+inline bool MappedVector<Data>::operator!=(const MappedVector<Data>& other)
+  const noexcept {
+    return !(*this == other);
+}
+
+/* ************************************************************************** */
+
+template <typename Data>
+inline const std::filesystem::path& MappedVector<Data>::Path() const noexcept {
+  return path;
+}
+
+template <typename Data>
+inline MapMode MappedVector<Data>::Mode() const noexcept {
+  return mode;
+}
+
+template <typename Data>
+inline ulong MappedVector<Data>::Tag() const noexcept {
+  return tag;
+}
+
+template <typename Data>
+inline ulong MappedVector<Data>::Capacity() const noexcept {
+  return capacity;
+}
+
+template <typename Data>
+void MappedVector<Data>::Sync() {
+  if (mode != MapMode::ReadWrite || map == nullptr)
+                                    return;
+  if (::msync(map, Bytes(capacity), MS_SYNC) != 0) {
+    throw std::runtime_error("Cannot write " + path.string());
+  }
+}
+
+/* ************************************************************************** */
+
+template <typename Data>
+Data& MappedVector<Data>::operator[](ulong index) {
+  Writable();
+  if (index >= size) {
+    throw std::out_of_range("Index out of range");
+  }
+  return Elements()[index];
+}
+
+template <typename Data>
+Data& MappedVector<Data>::Front() {
+  Writable();
+  if (size == 0) {
+    throw std::length_error("Vector is empty");
+  }
+  return Elements()[0];
+}
+
+template <typename Data>
+Data& MappedVector<Data>::Back() {
+  Writable();
+  if (size == 0) {
+    throw std::length_error("Vector is empty");
+  }
+  return Elements()[size - 1];
+}
+
+/* ************************************************************************** */
+
+template <typename Data>
+const Data& MappedVector<Data>::operator[](ulong index) const {
+  if (index >= size) {
+    throw std::out_of_range("Index out of range");
+  }
+  return Elements()[index];
+}
+
+template <typename Data>
+const Data& MappedVector<Data>::Front() const {
+  if (size == 0) {
+    throw std::length_error("Vector is empty");
+  }
+  return Elements()[0];
+}
+
+template <typename Data>
+const Data& MappedVector<Data>::Back() const {
+  if (size == 0) {
+    throw std::length_error("Vector is empty");
+  }
+  return Elements()[size - 1];
+}
+
+/* ************************************************************************** */
+
+template <typename Data>
+void MappedVector<Data>::Resize(ulong newSize) {
+  Writable();
+  if (newSize > capacity || map == nullptr)
+    Remap(std::max(newSize, 2 * capacity));
+  Data* buf = Elements();
+  for (ulong i = size; i < newSize; ++i)
+    buf[i] = Data();
+  size = newSize;
+  Head()->size = size;
+}
+
+template <typename Data>
+void MappedVector<Data>::Clear() noexcept {
+  size = 0;
+  if (map == nullptr)
+            return;
+  if (mode == MapMode::ReadOnly)
+                        return;
+  Head()->size = 0;
+  if (mode == MapMode::ReadWrite) {
+    Unmap();
+    capacity = 0;
+    if (::ftruncate(file, dataOffset) == 0) {
+      void* fresh = ::mmap(nullptr, dataOffset, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+      map = (fresh == MAP_FAILED) ? nullptr : fresh;
+    }
+  }
+}
+
+/* ************************************************************************** */
+
+template <typename Data>
+inline typename MappedVector<Data>::Header* MappedVector<Data>::Head() const noexcept {
+  return static_cast<Header*>(map);
+}
+
+template <typename Data>
+inline Data* MappedVector<Data>::Elements() const noexcept {
+  return reinterpret_cast<Data*>(static_cast<char*>(map) + dataOffset);
+}
+
+template <typename Data>
+inline ulong MappedVector<Data>::Bytes(ulong cap) noexcept {
+  return dataOffset + cap * sizeof(Data);
+}
+
+template <typename Data>
+void MappedVector<Data>::Stamp(Header* head) const noexcept {
+  std::memcpy(head->magic, magic, sizeof(magic));
+  head->elementSize = sizeof(Data);
+  head->tag = tag;
+  head->size = size;
+}
+
+// A read-write vector extends its file and maps it anew; the old and the new
+// mapping share the same pages, so nothing is copied. A copy-on-write vector
+// must not touch its file: its header and elements are copied into private
+// memory instead.
+template <typename Data>
+void MappedVector<Data>::Remap(ulong cap) {
+  void* fresh;
+  if (mode == MapMode::ReadWrite) {
+    if (::ftruncate(file, Bytes(cap)) != 0) {
+      throw std::runtime_error("Cannot extend " + path.string());
+    }
+    fresh = ::mmap(nullptr, Bytes(cap), PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+  } else
+    fresh = ::mmap(nullptr, Bytes(cap), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (fresh == MAP_FAILED) {
+    throw std::runtime_error("Cannot map " + path.string());
+  }
+  if (mode == MapMode::CopyOnWrite)
+    std::memcpy(fresh, map, Bytes(size));
+  Unmap();
+  map = fresh;
+  capacity = cap;
+}
+
+template <typename Data>
+void MappedVector<Data>::Unmap() noexcept {
+  if (map != nullptr)
+    ::munmap(map, Bytes(capacity));
+  map = nullptr;
+}
+
+template <typename Data>
+inline void MappedVector<Data>::Writable() const {
+  if (mode == MapMode::ReadOnly) {
+    throw std::logic_error("Vector is mapped read-only");
+  }
+}
+
+template <typename Data>
+void MappedVector<Data>::Fail(const std::string& msg) {
+  Unmap();
+  ::close(file);
+  file = -1;
+  throw std::runtime_error(msg);
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,174 @@
+
+#ifndef MAPPEDVECTOR_HPP
+#define MAPPEDVECTOR_HPP
+
+/* ************************************************************************** */
+
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+/* ************************************************************************** */
+
+#include "../../container/linear.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+enum class MapMode {
+  ReadWrite, // Changes and growth go to the file, which is created when missing
+  ReadOnly, // Any change is refused
+  CopyOnWrite // Changes and growth stay private to the vector; the file is left as it is
+};
+
+// Vector persisted in a file and mapped into memory. Opening it maps the
+// file and reads nothing, so its cost does not depend on the size: elements
+// are paged in on first access. The file starts with a small header giving
+// the element size, a tag chosen by the caller to tell kinds of records
+// apart, and the number of elements, followed by the elements as raw bytes
+// from a cache line boundary; hence Data must be trivially copyable.
+// Growing a read-write vector extends the file (geometrically, so that it is
+// remapped only now and then), and shrinking keeps the room for later. A
+// copy-on-write vector grown past its file moves to private memory. Mutable
+// access to a read-only vector throws std::logic_error; this includes the
+// non-const operator[], Front and Back even when they are only used to read,
+// so a read-only vector is best read through a const reference.
+
+template <typename Data>
+class MappedVector : virtual public MutableLinearContainer<Data>,
+  virtual public ResizableContainer {
+  // Must extend MutableLinearContainer<Data>,
+  //             ResizableContainer
+
+  static_assert(std::is_trivially_copyable_v<Data>, "MappedVector stores elements as raw bytes");
+  static_assert(alignof(Data) <= 64, "MappedVector aligns elements to a cache line at most");
+
+private:
+
+  // ...
+
+protected:
+
+  struct Header {
+
+    char magic[8];
+    std::uint64_t elementSize;
+    std::uint64_t tag;
+    std::uint64_t size;
+
+  };
+
+  static const ulong dataOffset = 64; // Elements start on the cache line after the header
+  static constexpr char magic[8] = "LASDVEC";
+
+  using Container::size;
+
+  std::filesystem::path path;
+  MapMode mode = MapMode::ReadWrite;
+  ulong tag = 0;
+  int file = -1;
+  void* map = nullptr; // Header and elements (nullptr when a mapping could not be restored)
+  ulong capacity = 0; // Elements the mapping has room for
+
+public:
+
+  // Specific constructors
+  MappedVector(const std::filesystem::path&, MapMode = MapMode::ReadWrite, ulong = 0); // File, open mode, tag (must throw std::runtime_error when the file cannot be opened or mapped, or does not hold a vector of Data with that tag)
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  MappedVector(const MappedVector&) = delete; // Copy of a vector backed by a file is not possible.
+
+  // Move constructor
+  MappedVector(MappedVector&&) = delete; // Move of a vector backed by a file is not possible.
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual
+  ~MappedVector();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  MappedVector& operator=(const MappedVector&) = delete; // Copy assignment of a vector backed by a file is not possible.
+
+  // Move assignment
+  MappedVector& operator=(MappedVector&&) = delete; // Move assignment of a vector backed by a file is not possible.
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const MappedVector&) const noexcept;
+  bool operator!=(const MappedVector&) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  const std::filesystem::path& Path() const noexcept;
+  MapMode Mode() const noexcept;
+  ulong Tag() const noexcept;
+  ulong Capacity() const noexcept;
+
+  void Sync(); // Writes changes through to the file, for a read-write vector (must throw std::runtime_error when they cannot be written)
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from MutableLinearContainer)
+
+  Data& operator[](ulong) override; // Override MutableLinearContainer member (must throw std::out_of_range when out of range, std::logic_error when read-only)
+  Data& Front() override; // Override MutableLinearContainer member (must throw std::length_error when empty, std::logic_error when read-only)
+  Data& Back() override; // Override MutableLinearContainer member (must throw std::length_error when empty, std::logic_error when read-only)
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from LinearContainer)
+
+  const Data& operator[](ulong) const override; // Override LinearContainer member (must throw std::out_of_range when out of range)
+  const Data& Front() const override; // Override LinearContainer member (must throw std::length_error when empty)
+  const Data& Back() const override; // Override LinearContainer member (must throw std::length_error when empty)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ResizableContainer)
+
+  void Resize(ulong) override; // Override ResizableContainer member (must throw std::logic_error when read-only, std::runtime_error when the file cannot grow)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() noexcept override; // Override ClearableContainer member (a read-write vector truncates its file; otherwise only the view is emptied)
+
+  using LinearContainer<Data>::Traverse;
+
+protected:
+
+  // Auxiliary functions, if necessary!
+
+  Header* Head() const noexcept;
+  Data* Elements() const noexcept;
+  static ulong Bytes(ulong) noexcept; // File or mapping length for a given capacity
+
+  void Stamp(Header*) const noexcept; // Writes a header for the current size
+  void Remap(ulong); // Room for the given capacity, keeping the elements
+  void Unmap() noexcept;
+  void Writable() const; // (must throw std::logic_error when read-only)
+  [[noreturn]] void Fail(const std::string&); // Releases what the constructor acquired, then throws std::runtime_error
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "mappedvector.cpp"
+
+#endif
@@ -0,0 +1,216 @@
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// ...
+
+template <typename Data, ulong N>
+SmallVector<Data, N>::SmallVector(ulong dim)
+{
+  size = 0;
+  Resize(dim);
+}
+
+template <typename Data, ulong N>
+SmallVector<Data, N>::SmallVector(const TraversableContainer<Data>& box)
+  : SmallVector(box.Size()) {
+  ulong i = 0;
+  box.Traverse(
+    [this, &i](const Data& dat)
+    {
+      buffer[i++] = dat;
+    }
+  );
+}
+
+template <typename Data, ulong N>
+SmallVector<Data, N>::SmallVector(MappableContainer<Data>&& box)
+  : SmallVector(box.Size()) {
+  ulong i = 0;
+  box.Map(
+    [this, &i](Data& dat)
+    {
+      buffer[i++] = std::move(dat);
+    }
+  );
+}
+
+template <typename Data, ulong N>
+SmallVector<Data, N>::SmallVector(const SmallVector<Data, N>& other)
+  : SmallVector(other.size) {
+  for (ulong i = 0; i < size; ++i)
+    buffer[i] = other.buffer[i];
+}
+
+template <typename Data, ulong N>
+SmallVector<Data, N>::SmallVector(SmallVector<Data, N>&& other)
+  noexcept {
+    size = 0;
+    *this = std::move(other);
+}
+
+template <typename Data, ulong N>
+SmallVector<Data, N>::~SmallVector()
+{
+  Clear();
+}
+
+template <typename Data, ulong N>
+SmallVector<Data, N>& SmallVector<Data, N>::operator=(const SmallVector<Data, N>& other)
+{
+  if (this == &other) return *this;
+
+  SmallVector<Data, N> tmp(other);
+  *this = std::move(tmp);
+  return *this;
+}
+
+// A heap buffer changes hands; inline elements can only be moved across.
+template <typename Data, ulong N>
+SmallVector<Data, N>& SmallVector<Data, N>::operator=(SmallVector<Data, N>&& other)
+  noexcept {
+    if (this == &other) return *this;
+
+    SmallVector<Data, N>::Clear();
+    if (!other.Inline()) {
+      buffer = other.buffer;
+      other.buffer = other.local;
+    }
+    else {
+      for (ulong i = 0; i < other.size; ++i)
+        local[i] = std::move(other.local[i]);
+      other.ResetLocal(0, other.size);
+    }
+    size = other.size;
+    other.size = 0;
+    return *this;
+}
+
+template <typename Data, ulong N>
+inline bool SmallVector<Data, N>::operator==(const SmallVector<Data, N>& other)
+  const noexcept {
+    return LinearContainer<Data>::operator==(other);
+}
+
+template <typename Data, ulong N>
+inline bool SmallVector<Data, N>::operator!=(const SmallVector<Data, N>& other)
+  const noexcept {
+    return LinearContainer<Data>::operator!=(other);
+}
+
+/* ************************************************************************** */
+
+template <typename Data, ulong N>
+inline bool SmallVector<Data, N>::Inline() const noexcept {
+  return buffer == local;
+}
+
+/* ************************************************************************** */
+
+template <typename Data, ulong N>
+inline Data& SmallVector<Data, N>::operator[](ulong idx)
+{
+  if (idx >= size)
+    throw std::out_of_range("Index bigger than last element's index");
+  return buffer[idx];
+}
+
+template <typename Data, ulong N>
+inline Data& SmallVector<Data, N>::Front()
+{
+  if (Empty())
+    throw std::length_error("Invalid access to empty vector");
+  return buffer[0];
+}
+
+template <typename Data, ulong N>
+inline Data& SmallVector<Data, N>::Back()
+{
+  if (Empty())
+    throw std::length_error("Invalid access to empty vector");
+  return buffer[size - 1];
+}
+
+template <typename Data, ulong N>
+inline const Data& SmallVector<Data, N>::operator[](ulong idx)
+  const {
+    if (idx >= size)
+      throw std::out_of_range("Index bigger than last element's index");
+  return buffer[idx];
+}
+
+template <typename Data, ulong N>
+inline const Data& SmallVector<Data, N>::Front()
+  const {
+    if (Empty())
+      throw std::length_error("Invalid access to empty vector");
+    return buffer[0];
+}
+
+template <typename Data, ulong N>
+inline const Data& SmallVector<Data, N>::Back()
+  const {
+    if (Empty())
+      throw std::length_error("Invalid access to empty vector");
+    return buffer[size - 1];
+}
+
+/* ************************************************************************** */
+
+// Only crossing N moves elements between the inline room and the heap; any
+// other resize beyond N reallocates as Vector does.
+template <typename Data, ulong N>
+void SmallVector<Data, N>::Resize(ulong newSize)
+{
+  if (newSize == 0) {
+    SmallVector<Data, N>::Clear();
+    return;
+  }
+  ulong keep = std::min(size, newSize);
+  if (newSize <= N) {
+    if (Inline())
+      ResetLocal(newSize, size);
+    else {
+      for (ulong i = 0; i < keep; ++i)
+        local[i] = std::move(buffer[i]);
+      delete[] buffer;
+      buffer = local;
+    }
+  }
+  else {
+    Data* newBuffer = new Data[newSize]{};
+    for (ulong i = 0; i < keep; ++i)
+      newBuffer[i] = std::move(buffer[i]);
+    if (Inline())
+      ResetLocal(0, size);
+    else
+      delete[] buffer;
+    buffer = newBuffer;
+  }
+  size = newSize;
+}
+
+template <typename Data, ulong N>
+void SmallVector<Data, N>::Clear()
+  noexcept {
+    if (Inline())
+      ResetLocal(0, size);
+    else
+      delete[] buffer;
+    buffer = local;
+    size = 0;
+}
+
+/* ************************************************************************** */
+
+template <typename Data, ulong N>
+void SmallVector<Data, N>::ResetLocal(ulong from, ulong to)
+  noexcept {
+    for (ulong i = from; i < to; ++i)
+      local[i] = Data();
+}
+
+/* ************************************************************************** */
+
+}
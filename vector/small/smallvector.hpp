@@ -0,0 +1,137 @@
+
+#ifndef SMALLVECTOR_HPP
+#define SMALLVECTOR_HPP
+
+/* ************************************************************************** */
+
+#include <algorithm>
+
+/* ************************************************************************** */
+
+#include "../../container/linear.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Vector with room for N elements inside the object itself: up to N elements
+// it never touches the heap, beyond that it spills to a buffer allocated as
+// Vector does. Shrinking back to N or fewer moves the elements home and
+// releases the buffer. Inline elements past the size are kept at their
+// default value. Moving a SmallVector that fits inline moves its elements
+// one by one, so it is O(N) rather than O(1).
+// It can stand in for Vector as the storage of a SetVec, keeping sets of up
+// to N elements off the heap.
+
+template <typename Data, ulong N = 16>
+class SmallVector : virtual public MutableLinearContainer<Data>,
+  virtual public ResizableContainer {
+  // Must extend MutableLinearContainer<Data>,
+  //             ResizableContainer
+
+  static_assert(N > 0, "SmallVector needs room for at least one element");
+
+private:
+
+  // ...
+
+protected:
+
+  using Container::size;
+
+  Data local[N]{};
+  Data* buffer = local; // local, or a heap buffer of size elements
+
+public:
+
+  // Default constructor
+  SmallVector() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  SmallVector(ulong); // A vector with a given initial dimension
+  SmallVector(const TraversableContainer<Data>&); // A vector obtained from a TraversableContainer
+  SmallVector(MappableContainer<Data>&&); // A vector obtained from a MappableContainer
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  SmallVector(const SmallVector&);
+
+  // Move constructor
+  SmallVector(SmallVector&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual
+  ~SmallVector();
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  SmallVector& operator=(const SmallVector&);
+
+  // Move assignment
+  SmallVector& operator=(SmallVector&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const SmallVector&) const noexcept;
+  bool operator!=(const SmallVector&) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  bool Inline() const noexcept; // Whether the elements are inside the object
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from MutableLinearContainer)
+
+  Data& operator[](ulong) override; // Override MutableLinearContainer member (must throw std::out_of_range when out of range)
+  Data& Front() override; // Override MutableLinearContainer member (must throw std::length_error when empty)
+  Data& Back() override; // Override MutableLinearContainer member (must throw std::length_error when empty)
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from LinearContainer)
+
+  const Data& operator[](ulong) const override; // Override LinearContainer member (must throw std::out_of_range when out of range)
+  const Data& Front() const override; // Override LinearContainer member (must throw std::length_error when empty)
+  const Data& Back() const override; // Override LinearContainer member (must throw std::length_error when empty)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ResizableContainer)
+
+  void Resize(ulong) override; // Override ResizableContainer member
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() noexcept override; // Override ClearableContainer member
+
+  using LinearContainer<Data>::Traverse;
+
+protected:
+
+  // Auxiliary functions, if necessary!
+
+  void ResetLocal(ulong, ulong) noexcept; // Default value for the inline elements in a range
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "smallvector.cpp"
+
+#endif
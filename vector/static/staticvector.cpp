@@ -0,0 +1,184 @@
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// ...
+
+template <typename Data, ulong N>
+StaticVector<Data, N>::StaticVector(ulong dim)
+{
+  size = 0;
+  Resize(dim);
+}
+
+template <typename Data, ulong N>
+StaticVector<Data, N>::StaticVector(const TraversableContainer<Data>& box)
+  : StaticVector(box.Size()) {
+  ulong i = 0;
+  box.Traverse(
+    [this, &i](const Data& dat)
+    {
+      elements[i++] = dat;
+    }
+  );
+}
+
+template <typename Data, ulong N>
+StaticVector<Data, N>::StaticVector(MappableContainer<Data>&& box)
+  : StaticVector(box.Size()) {
+  ulong i = 0;
+  box.Map(
+    [this, &i](Data& dat)
+    {
+      elements[i++] = std::move(dat);
+    }
+  );
+}
+
+template <typename Data, ulong N>
+StaticVector<Data, N>::StaticVector(const StaticVector<Data, N>& other)
+{
+  size = other.size;
+  for (ulong i = 0; i < size; ++i)
+    elements[i] = other.elements[i];
+}
+
+template <typename Data, ulong N>
+StaticVector<Data, N>::StaticVector(StaticVector<Data, N>&& other)
+  noexcept {
+    size = 0;
+    *this = std::move(other);
+}
+
+template <typename Data, ulong N>
+StaticVector<Data, N>& StaticVector<Data, N>::operator=(const StaticVector<Data, N>& other)
+{
+  if (this == &other) return *this;
+
+  for (ulong i = 0; i < other.size; ++i)
+    elements[i] = other.elements[i];
+  for (ulong i = other.size; i < size; ++i)
+    elements[i] = Data();
+  size = other.size;
+  return *this;
+}
+
+template <typename Data, ulong N>
+StaticVector<Data, N>& StaticVector<Data, N>::operator=(StaticVector<Data, N>&& other)
+  noexcept {
+    if (this == &other) return *this;
+
+    for (ulong i = 0; i < other.size; ++i)
+      elements[i] = std::move(other.elements[i]);
+    for (ulong i = other.size; i < size; ++i)
+      elements[i] = Data();
+    size = other.size;
+    other.Clear();
+    return *this;
+}
+
+template <typename Data, ulong N>
+inline bool StaticVector<Data, N>::operator==(const StaticVector<Data, N>& other)
+  const noexcept {
+    return LinearContainer<Data>::operator==(other);
+}
+
+template <typename Data, ulong N>
+inline bool StaticVector<Data, N>::operator!=(const StaticVector<Data, N>& other)
+  const noexcept {
+    return LinearContainer<Data>::operator!=(other);
+}
+
+/* ************************************************************************** */
+
+template <typename Data, ulong N>
+inline ulong StaticVector<Data, N>::Capacity() const noexcept {
+  return N;
+}
+
+template <typename Data, ulong N>
+inline bool StaticVector<Data, N>::Full() const noexcept {
+  return size == N;
+}
+
+template <typename Data, ulong N>
+bool StaticVector<Data, N>::TryResize(ulong newSize) {
+  if (newSize > N)
+          return false;
+  for (ulong i = newSize; i < size; ++i)
+    elements[i] = Data();
+  size = newSize;
+  return true;
+}
+
+/* ************************************************************************** */
+
+template <typename Data, ulong N>
+inline Data& StaticVector<Data, N>::operator[](ulong idx)
+{
+  if (idx >= size)
+    throw std::out_of_range("Index bigger than last element's index");
+  return elements[idx];
+}
+
+template <typename Data, ulong N>
+inline Data& StaticVector<Data, N>::Front()
+{
+  if (Empty())
+    throw std::length_error("Invalid access to empty vector");
+  return elements[0];
+}
+
+template <typename Data, ulong N>
+inline Data& StaticVector<Data, N>::Back()
+{
+  if (Empty())
+    throw std::length_error("Invalid access to empty vector");
+  return elements[size - 1];
+}
+
+template <typename Data, ulong N>
+inline const Data& StaticVector<Data, N>::operator[](ulong idx)
+  const {
+    if (idx >= size)
+      throw std::out_of_range("Index bigger than last element's index");
+  return elements[idx];
+}
+
+template <typename Data, ulong N>
+inline const Data& StaticVector<Data, N>::Front()
+  const {
+    if (Empty())
+      throw std::length_error("Invalid access to empty vector");
+    return elements[0];
+}
+
+template <typename Data, ulong N>
+inline const Data& StaticVector<Data, N>::Back()
+  const {
+    if (Empty())
+      throw std::length_error("Invalid access to empty vector");
+    return elements[size - 1];
+}
+
+/* ************************************************************************** */
+
+template <typename Data, ulong N>
+void StaticVector<Data, N>::Resize(ulong newSize)
+{
+  if (!TryResize(newSize))
+    throw std::length_error("Size beyond the capacity of a static vector");
+}
+
+template <typename Data, ulong N>
+void StaticVector<Data, N>::Clear()
+  noexcept {
+    for (ulong i = 0; i < size; ++i)
+      elements[i] = Data();
+    size = 0;
+}
+
+/* ************************************************************************** */
+
+}
@@ -0,0 +1,126 @@
+
+#ifndef STATICVECTOR_HPP
+#define STATICVECTOR_HPP
+
+/* ************************************************************************** */
+
+#include "../../container/linear.hpp"
+
+/* ************************************************************************** */
+
+namespace lasd {
+
+/* ************************************************************************** */
+
+// Vector of at most N elements, all kept inside the object: it never touches
+// the allocator. Growing past N is refused: TryResize reports it by returning
+// false, while Resize, bound by the ResizableContainer interface, throws
+// std::length_error. Elements past the size are kept at their default value.
+// Copying and moving go element by element.
+
+template <typename Data, ulong N>
+class StaticVector : virtual public MutableLinearContainer<Data>,
+  virtual public ResizableContainer {
+  // Must extend MutableLinearContainer<Data>,
+  //             ResizableContainer
+
+  static_assert(N > 0, "StaticVector needs room for at least one element");
+
+private:
+
+  // ...
+
+protected:
+
+  using Container::size;
+
+  Data elements[N]{};
+
+public:
+
+  // Default constructor
+  StaticVector() = default;
+
+  /* ************************************************************************ */
+
+  // Specific constructors
+  StaticVector(ulong); // A vector with a given initial dimension (must throw std::length_error beyond N)
+  StaticVector(const TraversableContainer<Data>&); // A vector obtained from a TraversableContainer (must throw std::length_error beyond N)
+  StaticVector(MappableContainer<Data>&&); // A vector obtained from a MappableContainer (must throw std::length_error beyond N)
+
+  /* ************************************************************************ */
+
+  // Copy constructor
+  StaticVector(const StaticVector&);
+
+  // Move constructor
+  StaticVector(StaticVector&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Destructor
+  virtual
+  ~StaticVector() = default;
+
+  /* ************************************************************************ */
+
+  // Copy assignment
+  StaticVector& operator=(const StaticVector&);
+
+  // Move assignment
+  StaticVector& operator=(StaticVector&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Comparison operators
+  bool operator==(const StaticVector&) const noexcept;
+  bool operator!=(const StaticVector&) const noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  ulong Capacity() const noexcept;
+  bool Full() const noexcept;
+
+  bool TryResize(ulong); // Non-throwing counterpart of Resize: false beyond N, leaving the vector as it is
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from MutableLinearContainer)
+
+  Data& operator[](ulong) override; // Override MutableLinearContainer member (must throw std::out_of_range when out of range)
+  Data& Front() override; // Override MutableLinearContainer member (must throw std::length_error when empty)
+  Data& Back() override; // Override MutableLinearContainer member (must throw std::length_error when empty)
+
+  /* ************************************************************************ */
+
+  // Specific member functions (inherited from LinearContainer)
+
+  const Data& operator[](ulong) const override; // Override LinearContainer member (must throw std::out_of_range when out of range)
+  const Data& Front() const override; // Override LinearContainer member (must throw std::length_error when empty)
+  const Data& Back() const override; // Override LinearContainer member (must throw std::length_error when empty)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ResizableContainer)
+
+  void Resize(ulong) override; // Override ResizableContainer member (must throw std::length_error beyond N)
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from ClearableContainer)
+
+  void Clear() noexcept override; // Override ClearableContainer member
+
+  using LinearContainer<Data>::Traverse;
+
+};
+
+/* ************************************************************************** */
+
+}
+
+#include "staticvector.cpp"
+
+#endif
@@ -13,12 +13,21 @@ Vector<Data>::Vector()
 
 template <typename Data>
 Vector<Data>::Vector(ulong dim)
-{
+  : Vector(dim, nullptr) {}
+
+template <typename Data>
+Vector<Data>::Vector(std::pmr::memory_resource& res)
+  : Vector(0, &res) {}
+
+template <typename Data>
+Vector<Data>::Vector(ulong dim, std::pmr::memory_resource& res)
+  : Vector(dim, &res) {}
+
+template <typename Data>
+Vector<Data>::Vector(ulong dim, std::pmr::memory_resource* res)
+  : resource(res) {
   size = dim;
-  if (size > 0)
-      buffer = new Data[size]{};
-  else
-    buffer = nullptr;
+  buffer = Allocate(size);
 }
 
 template <typename Data>
@@ -87,6 +96,7 @@ inline Vector<Data>& Vector<Data>::operator=(Vector<Data>&& other)
   noexcept {
     std::swap(size, other.size);
     std::swap(buffer, other.buffer);
+    std::swap(resource, other.resource);
     return *this;
 }
 
@@ -156,7 +166,7 @@ inline void Vector<Data>::Resize(ulong newSize)
   if (0 == newSize)
            Clear();
   else {
-    Vector<Data> newVector(newSize);
+    Vector<Data> newVector(newSize, resource);
     this->Transfer(newVector, 0, std::min(size, newVector.size), 0);
     *this = std::move(newVector);
   }
@@ -165,16 +175,55 @@ inline void Vector<Data>::Resize(ulong newSize)
 template <typename Data>
 void Vector<Data>::Clear()
   noexcept {
-    delete[] buffer;
+    Release(buffer, size);
     buffer = nullptr;
     size = 0;
 }
 
+template <typename Data>
+inline std::pmr::memory_resource* Vector<Data>::Resource()
+  const noexcept {
+    return resource;
+}
+
+// Without a resource the buffer comes from new[], as it always did. With one,
+// raw storage is taken from the resource and the elements are constructed in
+// place; a monotonic resource then frees everything at once when released.
+template <typename Data>
+Data* Vector<Data>::Allocate(ulong dim)
+  const {
+    if (dim == 0)
+          return nullptr;
+    if (resource == nullptr)
+      return new Data[dim]{};
+    Data* buf = static_cast<Data*>(resource->allocate(dim * sizeof(Data), alignof(Data)));
+    try {
+      std::uninitialized_value_construct_n(buf, dim);
+    } catch (...) {
+      resource->deallocate(buf, dim * sizeof(Data), alignof(Data));
+      throw;
+    }
+    return buf;
+}
+
+template <typename Data>
+void Vector<Data>::Release(Data* buf, ulong dim)
+  const noexcept {
+    if (buf == nullptr)
+              return;
+    if (resource == nullptr) {
+      delete[] buf;
+      return;
+    }
+    std::destroy_n(buf, dim);
+    resource->deallocate(buf, dim * sizeof(Data), alignof(Data));
+}
+
 template <typename Data>
 inline void Vector<Data>::EnsureCapacity(ulong dim)
 {
   if (Size() != dim)
-    *this = Vector(dim);
+    *this = Vector(dim, resource);
 }
 
 template <typename Data>
@@ -203,40 +252,56 @@ inline void Vector<Data>::Transfer(Vector<Data> &receiver, ulong srcStart, int g
 
 /* ***************************SortableVector********************************* */
 
-template <typename Data>
-SortableVector<Data>::SortableVector(ulong dim)
-  : Vector<Data>(dim) {}
+template <typename Data, typename Compare>
+SortableVector<Data, Compare>::SortableVector(const Compare& comp)
+  : comp(comp) {}
 
-template <typename Data>
-SortableVector<Data>::SortableVector(const TraversableContainer<Data>& box)
-  : Vector<Data>(box) {}
+template <typename Data, typename Compare>
+SortableVector<Data, Compare>::SortableVector(std::pmr::memory_resource& res, const Compare& comp)
+  : Vector<Data>(res), comp(comp) {}
 
-template <typename Data>
-SortableVector<Data>::SortableVector(MappableContainer<Data>&& box)
-  : Vector<Data>(std::move(box)) {}
+template <typename Data, typename Compare>
+SortableVector<Data, Compare>::SortableVector(ulong dim, const Compare& comp)
+  : Vector<Data>(dim), comp(comp) {}
 
-template <typename Data>
-SortableVector<Data>::SortableVector(const SortableVector<Data>& other)
-  : Vector<Data>(other) {}
+template <typename Data, typename Compare>
+SortableVector<Data, Compare>::SortableVector(const TraversableContainer<Data>& box, const Compare& comp)
+  : Vector<Data>(box), comp(comp) {}
 
-template <typename Data>
-SortableVector<Data>::SortableVector(SortableVector<Data>&& other)
-  noexcept : Vector<Data>(std::move(other)) {}
+template <typename Data, typename Compare>
+SortableVector<Data, Compare>::SortableVector(MappableContainer<Data>&& box, const Compare& comp)
+  : Vector<Data>(std::move(box)), comp(comp) {}
 
-template <typename Data>
-SortableVector<Data>& SortableVector<Data>::operator=(const SortableVector<Data>& other)
+template <typename Data, typename Compare>
+SortableVector<Data, Compare>::SortableVector(const SortableVector<Data, Compare>& other)
+  : Vector<Data>(other), comp(other.comp) {}
+
+template <typename Data, typename Compare>
+SortableVector<Data, Compare>::SortableVector(SortableVector<Data, Compare>&& other)
+  noexcept : Vector<Data>(std::move(other)), comp(other.comp) {}
+
+template <typename Data, typename Compare>
+SortableVector<Data, Compare>& SortableVector<Data, Compare>::operator=(const SortableVector<Data, Compare>& other)
 {
   Vector<Data>::operator=(other);
+  comp = other.comp;
   return *this;
 }
 
-template <typename Data>
-SortableVector<Data>& SortableVector<Data>::operator=(SortableVector<Data>&& other)
+template <typename Data, typename Compare>
+SortableVector<Data, Compare>& SortableVector<Data, Compare>::operator=(SortableVector<Data, Compare>&& other)
   noexcept {
     Vector<Data>::operator=(std::move(other));
+    comp = other.comp;
     return *this;
 }
 
+template <typename Data, typename Compare>
+void SortableVector<Data, Compare>::Sort()
+  noexcept {
+    InsertionSortRange(this->buffer, size, comp);
+}
+
 /* ************************************************************************** */
 
 }
@@ -4,7 +4,13 @@
 
 /* ************************************************************************** */
 
+#include <memory>
+#include <memory_resource>
+
+/* ************************************************************************** */
+
 #include "../container/linear.hpp"
+#include "../container/sorting.hpp"
 
 /* ************************************************************************** */
 
@@ -27,8 +33,12 @@ protected:
   using Container::size;
   Data *buffer;
 
+  std::pmr::memory_resource* resource = nullptr; // Where the buffer is allocated (nullptr: the free store)
+
   // ...
 
+  Vector(ulong, std::pmr::memory_resource*);
+
 public:
 
   // Default constructor
@@ -38,6 +48,8 @@ public:
 
   // Specific constructors
   Vector(ulong); // A vector with a given initial dimension
+  explicit Vector(std::pmr::memory_resource&); // An empty vector allocating from the given memory resource
+  Vector(ulong, std::pmr::memory_resource&); // A vector with a given initial dimension, allocated from the given memory resource
   Vector(const TraversableContainer<Data>&); // A vector obtained from a TraversableContainer
   Vector(MappableContainer<Data>&&); // A vector obtained from a MappableContainer
 
@@ -103,10 +115,19 @@ public:
  
   using LinearContainer<Data>::Traverse;
 
+  /* ************************************************************************ */
+
+  // Specific member functions
+
+  std::pmr::memory_resource* Resource() const noexcept; // The resource buffers are allocated from (nullptr: the free store)
+
 protected:
 
   // Auxiliary functions, if necessary!
 
+  Data* Allocate(ulong) const; // A buffer of value-initialized elements from the resource (nullptr when empty)
+  void Release(Data*, ulong) const noexcept; // Gives back a buffer obtained from Allocate
+
   virtual
   void EnsureCapacity(ulong dim);
   static ulong mod(int, int);  
@@ -117,7 +138,10 @@ protected:
 
 /* ************************************************************************** */
 
-template <typename Data>
+// Compare is a "less than" predicate fixing the sort order; a stateless
+// comparator takes no space and is inlined at every comparison.
+
+template <typename Data, typename Compare = std::less<Data>>
 class SortableVector : virtual public Vector<Data>,
   virtual public SortableLinearContainer<Data> {
   // Must extend Vector<Data>,
@@ -131,19 +155,21 @@ protected:
 
   using Container::size;
 
-  // ...
+  [[no_unique_address]] Compare comp{};
 
 public:
 
   // Default constructor
   SortableVector() = default;
+  explicit SortableVector(const Compare&); // An empty vector ordered by the given comparator
+  explicit SortableVector(std::pmr::memory_resource&, const Compare& = Compare()); // An empty vector allocating from the given memory resource
 
   /* ************************************************************************ */
 
   // Specific constructors
-  SortableVector(ulong); // A vector with a given initial dimension
-  SortableVector(const TraversableContainer<Data>&); // A vector obtained from a TraversableContainer
-  SortableVector(MappableContainer<Data>&&); // A vector obtained from a MappableContainer
+  SortableVector(ulong, const Compare& = Compare()); // A vector with a given initial dimension
+  SortableVector(const TraversableContainer<Data>&, const Compare& = Compare()); // A vector obtained from a TraversableContainer
+  SortableVector(MappableContainer<Data>&&, const Compare& = Compare()); // A vector obtained from a MappableContainer
 
   /* ************************************************************************ */
 
@@ -162,10 +188,18 @@ public:
   /* ************************************************************************ */
 
   // Copy assignment
-  SortableVector<Data>& operator=(const SortableVector<Data>&);
+  SortableVector& operator=(const SortableVector&);
 
   // Move assignment
-  SortableVector<Data>& operator=(SortableVector<Data>&&) noexcept;
+  SortableVector& operator=(SortableVector&&) noexcept;
+
+  /* ************************************************************************ */
+
+  // Specific member function (inherited from SortableLinearContainer)
+
+  void Sort() noexcept override; // Override SortableLinearContainer member (order given by Compare; stable insertion sort on the buffer)
+
+  using SortableLinearContainer<Data>::Sort;
 
 protected:
 
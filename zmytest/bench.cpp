@@ -0,0 +1,1869 @@
+#include <iostream>
+#include <stdlib.h>
+#include <random>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <memory_resource>
+#include <unistd.h>
+
+/* ************************************************************************** */
+
+#include "../container/testable.hpp"
+#include "../container/traversable.hpp"
+#include "../container/mappable.hpp"
+#include "../container/linear.hpp"
+#include "../vector/vector.hpp"
+#include "../vector/small/smallvector.hpp"
+#include "../vector/static/staticvector.hpp"
+#include "../vector/aligned/alignedresource.hpp"
+#include "../vector/mapped/mappedvector.hpp"
+#include "../list/list.hpp"
+#include "../set/vec/setvec.hpp"
+#include "../set/lst/setlst.hpp"
+#include "../set/tvec/settvec.hpp"
+#include "../set/frozen/setfrozen.hpp"
+#include "../heap/vec/heapvec.hpp"
+#include "../pq/heap/pqheap.hpp"
+#include "../pq/addr/pqaddr.hpp"
+#include "../pq/pairing/pqpairing.hpp"
+#include "../pq/minmax/pqminmax.hpp"
+#include "../pq/radix/pqradix.hpp"
+#include "../pq/multi/pqmulti.hpp"
+#include "../pq/topk/pqtopk.hpp"
+#include "../pq/stable/pqstable.hpp"
+#include "../pq/ext/pqext.hpp"
+#include "../pq/wheel/pqwheel.hpp"
+#include "../pq/static/pqstatic.hpp"
+
+/* ************************************************************************** */
+
+using namespace std;
+
+namespace myB
+{
+
+  // Workload sizes are kept small because the default build runs under
+  // -fsanitize=address; raise BENCH_SCALE on an -O3 build without sanitizers.
+  #define BENCH_SCALE 1
+  #define BENCH_SEED 42
+
+  static ulong benchnum = 0, bencherr = 0;
+
+  template <typename Fun>
+  double Measure(Fun f)
+  {
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+  }
+
+  void Report(const std::string& name, ulong ops, double ms)
+  {
+    std::cout << "  " << name << ": " << ms << " ms";
+    if (ops > 0)
+      std::cout << " (" << (ms * 1e6 / ops) << " ns/op)";
+    std::cout << std::endl;
+  }
+
+  void Check(const std::string& name, bool tst)
+  {
+    benchnum++;
+    bencherr += (1 - (ulong) tst);
+    std::cout << "  " << name << ": " << (tst ? "Correct" : "Error") << "!" << std::endl;
+  }
+
+  /* ************************************************************************ */
+
+  // k-th smallest key found the way it had to be done before Select():
+  // a full in-order traversal.
+  template <typename Data>
+  Data TraverseSelect(const lasd::Set<Data>& set, ulong k)
+  {
+    ulong i = 0;
+    Data ret{};
+    set.Traverse(
+      [&i, &ret, k](const Data& dat)
+      {
+        if (i++ == k)
+          ret = dat;
+      }
+    );
+    return ret;
+  }
+
+  template <typename Set>
+  void PercentileStream(const std::string& name, ulong streamLen, ulong window)
+  {
+    std::cout << name << " (stream of " << streamLen << " keys, percentiles every " << window << " keys)" << std::endl;
+
+    std::mt19937 gen(BENCH_SEED);
+    std::uniform_int_distribution<long> dist(0, 10 * streamLen);
+    lasd::Vector<long> stream(streamLen);
+    stream.Map([&gen, &dist](long& dat) { dat = dist(gen); });
+
+    const double quantiles[] = {0.5, 0.9, 0.99};
+    long nativeSum = 0, traverseSum = 0;
+    ulong queries = 0;
+
+    Set box;
+    lasd::Set<long>& set = box;
+    double insertMs = 0, nativeMs = 0, traverseMs = 0;
+    for (ulong i = 0; i < streamLen; ++i)
+    {
+      insertMs += Measure([&set, &stream, i]() { set.Insert(stream[i]); });
+      if ((i + 1) % window != 0)
+        continue;
+      for (double q : quantiles)
+      {
+        ulong k = static_cast<ulong>(q * (set.Size() - 1));
+        nativeMs += Measure([&set, &nativeSum, k]() { nativeSum += set.Select(k); });
+        traverseMs += Measure([&set, &traverseSum, k]() { traverseSum += TraverseSelect<long>(set, k); });
+        queries++;
+      }
+    }
+
+    long rankSum = 0, keySum = 0;
+    for (ulong i = 0; i < streamLen; i += 97)
+      keySum += stream[i];
+    double rankMs = Measure([&set, &stream, &rankSum, streamLen]() {
+      for (ulong i = 0; i < streamLen; i += 97)
+        rankSum += set.Select(set.Rank(stream[i]));
+    });
+
+    Report("Insert", streamLen, insertMs);
+    Report("Select percentile", queries, nativeMs);
+    Report("Traverse percentile", queries, traverseMs);
+    Report("Rank + Select round trip", streamLen / 97 + 1, rankMs);
+    Check("Select agrees with traversal", nativeSum == traverseSum);
+    Check("Round trips read back the keys", rankSum == keySum);
+  }
+
+  void RankSelectBench()
+  {
+    std::cout << std::endl << "~*~ Rank/Select benchmark ~*~" << std::endl;
+    PercentileStream<lasd::SetVec<long>>("SetVec<long>", 20000 * BENCH_SCALE, 500);
+    PercentileStream<lasd::SetLst<long>>("SetLst<long>", 2000 * BENCH_SCALE, 100);
+  }
+
+  /* ************************************************************************ */
+
+  // Key type that counts its default constructions: every buffer reallocation
+  // (new Data[n]) default-constructs n of them, so the counter measures how
+  // many slots a container has (re)allocated.
+  struct Counted
+  {
+    long key = 0;
+    static ulong allocated;
+
+    Counted() { allocated++; }
+    Counted(long k) : key(k) {}
+    Counted(const Counted&) = default;
+    Counted(Counted&&) = default;
+    Counted& operator=(const Counted&) = default;
+    Counted& operator=(Counted&&) = default;
+
+    bool operator==(const Counted& other) const { return key == other.key; }
+    bool operator!=(const Counted& other) const { return key != other.key; }
+    bool operator>(const Counted& other) const { return key > other.key; }
+    bool operator<(const Counted& other) const { return key < other.key; }
+  };
+
+  ulong Counted::allocated = 0;
+
+  // Insert/remove ping-pong at a fixed size: the set is filled to exactly its
+  // capacity so every other operation crosses the growth boundary.
+  void ChurnAt(const std::string& name, lasd::SetVec<Counted>& set, ulong rounds)
+  {
+    long outside = -1;
+    ulong before = Counted::allocated;
+    ulong sizeBefore = set.Size();
+    double ms = Measure([&set, rounds, outside]() {
+      for (ulong i = 0; i < rounds; ++i)
+      {
+        set.Insert(Counted(outside));
+        set.Remove(Counted(outside));
+      }
+    });
+    ulong slots = Counted::allocated - before;
+    Report(name, 2 * rounds, ms);
+    std::cout << "    slots reallocated: " << slots << " (" << (static_cast<double>(slots) / (2 * rounds)) << " per op), capacity " << set.Capacity() << std::endl;
+    Check(name + " keeps its size", set.Size() == sizeBefore);
+    Check(name + " reallocates at most once", slots <= 2 * set.Capacity());
+  }
+
+  void ChurnBench()
+  {
+    std::cout << std::endl << "~*~ SetVec churn benchmark ~*~" << std::endl;
+    const ulong rounds = 20000 * BENCH_SCALE;
+    const ulong sizes[] = {1000, 10000 * BENCH_SCALE};
+    for (ulong n : sizes)
+    {
+      std::cout << "SetVec<Counted> with " << n << " keys, " << rounds << " insert/remove rounds" << std::endl;
+
+      lasd::SetVec<Counted> fitted;
+      for (ulong i = 0; i < n; ++i)
+        fitted.Insert(Counted(i));
+      fitted.ShrinkToFit();
+      ChurnAt("Churn at capacity boundary", fitted, rounds);
+
+      lasd::SetVec<Counted> reserved;
+      reserved.Reserve(n + 1);
+      for (ulong i = 0; i < n; ++i)
+        reserved.Insert(Counted(i));
+      ChurnAt("Churn after Reserve(n + 1)", reserved, rounds);
+
+      ulong before = Counted::allocated;
+      for (ulong i = 0; i < n; ++i)
+        reserved.Remove(Counted(i));
+      Check("Reserve floor survives removals", reserved.Capacity() >= n + 1 && Counted::allocated == before);
+
+      // The batch reserves its room once; the per-key inserts must keep it
+      lasd::Vector<Counted> batch(n);
+      for (ulong i = 0; i < n; ++i)
+        batch[i] = Counted(i);
+      lasd::SetVec<Counted> filled;
+      before = Counted::allocated;
+      filled.InsertAll(batch);
+      ulong slots = Counted::allocated - before;
+      std::cout << "InsertAll of " << n << " keys reallocated " << slots << " slots" << std::endl;
+      Check("InsertAll allocates its buffer once", filled.Size() == n && slots <= 2 * n);
+    }
+  }
+
+  /* ************************************************************************ */
+
+  // Fills the set with n random keys, then runs a mixed stream of random
+  // inserts and removes that keeps the size around n.
+  template <typename Set>
+  double MixedWorkload(Set& set, ulong n, ulong ops)
+  {
+    std::mt19937 gen(BENCH_SEED);
+    std::uniform_int_distribution<long> dist(0, 4 * n);
+    while (set.Size() < n)
+      set.Insert(dist(gen));
+    return Measure([&set, &gen, &dist, ops]() {
+      for (ulong i = 0; i < ops; ++i)
+      {
+        set.Insert(dist(gen));
+        set.Remove(dist(gen));
+      }
+    });
+  }
+
+  template <typename SetA, typename SetB>
+  bool SameOrderedContents(const SetA& a, const SetB& b)
+  {
+    if (a.Size() != b.Size())
+      return false;
+    bool same = true;
+    for (ulong i = 0; same && i < a.Size(); ++i)
+      same = (a[i] == b[i]);
+    return same;
+  }
+
+  void TieredBench()
+  {
+    std::cout << std::endl << "~*~ SetVec vs SetTVec (tiered) benchmark ~*~" << std::endl;
+    const ulong ops = 5000 * BENCH_SCALE;
+    const ulong sizes[] = {1000, 10000, 100000 * BENCH_SCALE};
+    for (ulong n : sizes)
+    {
+      std::cout << "Mixed insert/remove around " << n << " keys, " << ops << " rounds" << std::endl;
+      lasd::SetVec<long> flat;
+      lasd::SetTVec<long> tiered;
+      Report("SetVec", 2 * ops, MixedWorkload(flat, n, ops));
+      Report("SetTVec", 2 * ops, MixedWorkload(tiered, n, ops));
+
+      long sumFlat = 0, sumTiered = 0;
+      Report("SetVec random Select", ops, Measure([&flat, &sumFlat, ops]() {
+        for (ulong i = 0; i < ops; ++i)
+          sumFlat += flat.Select((i * 7919) % flat.Size());
+      }));
+      Report("SetTVec random Select", ops, Measure([&tiered, &sumTiered, ops]() {
+        for (ulong i = 0; i < ops; ++i)
+          sumTiered += tiered.Select((i * 7919) % tiered.Size());
+      }));
+      Check("Both backends hold the same keys", SameOrderedContents(flat, tiered) && sumFlat == sumTiered);
+    }
+  }
+
+  /* ************************************************************************ */
+
+  // Successor queries over a key range mostly beyond the maximum, so that
+  // nine lookups out of ten miss.
+  template <typename Set>
+  void SuccessorScan(const std::string& name, ulong n, ulong queries)
+  {
+    std::cout << name << " (" << n << " keys, " << queries << " successor queries, ~90% misses)" << std::endl;
+    Set box;
+    for (ulong i = 0; i < n; ++i)
+      box.Insert(static_cast<long>(i));
+    const lasd::Set<long>& set = box;
+
+    long sumThrow = 0, sumTry = 0;
+    ulong missThrow = 0, missTry = 0;
+    Report("Successor + catch", queries, Measure([&set, &sumThrow, &missThrow, n, queries]() {
+      for (ulong i = 0; i < queries; ++i)
+      {
+        try { sumThrow += set.Successor(static_cast<long>(i % (10 * n))); }
+        catch (const std::length_error&) { missThrow++; }
+      }
+    }));
+    Report("TrySuccessor", queries, Measure([&set, &sumTry, &missTry, n, queries]() {
+      for (ulong i = 0; i < queries; ++i)
+      {
+        const long* succ = set.TrySuccessor(static_cast<long>(i % (10 * n)));
+        if (succ == nullptr) missTry++;
+        else sumTry += *succ;
+      }
+    }));
+    Check("TrySuccessor agrees with Successor", sumThrow == sumTry && missThrow == missTry);
+  }
+
+  void TryBench()
+  {
+    std::cout << std::endl << "~*~ Exception-free lookup benchmark ~*~" << std::endl;
+    SuccessorScan<lasd::SetVec<long>>("SetVec<long>", 1000, 200000 * BENCH_SCALE);
+    SuccessorScan<lasd::SetTVec<long>>("SetTVec<long>", 1000, 200000 * BENCH_SCALE);
+    SuccessorScan<lasd::SetLst<long>>("SetLst<long>", 100, 50000 * BENCH_SCALE);
+
+    const ulong polls = 200000 * BENCH_SCALE;
+    std::cout << "PQHeap<long> (" << polls << " polls of an empty queue)" << std::endl;
+    lasd::PQHeap<long> pq;
+    ulong missThrow = 0, missTry = 0;
+    Report("TipNRemove + catch", polls, Measure([&pq, &missThrow, polls]() {
+      for (ulong i = 0; i < polls; ++i)
+      {
+        try { pq.TipNRemove(); }
+        catch (const std::length_error&) { missThrow++; }
+      }
+    }));
+    Report("TryTipNRemove", polls, Measure([&pq, &missTry, polls]() {
+      for (ulong i = 0; i < polls; ++i)
+        missTry += !pq.TryTipNRemove().has_value();
+    }));
+    Check("Misses agree", missThrow == polls && missTry == polls && pq.TryTip() == nullptr);
+  }
+
+  /* ************************************************************************ */
+
+  lasd::Vector<long> RandomKeys(ulong n, ulong seed = BENCH_SEED)
+  {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<long> dist(0, 1L << 40);
+    lasd::Vector<long> keys(n);
+    keys.Map([&gen, &dist](long& dat) { dat = dist(gen); });
+    return keys;
+  }
+
+  template <ulong Arity>
+  void ArityRun(const lasd::Vector<long>& keys)
+  {
+    ulong n = keys.Size();
+    std::cout << "Arity " << Arity << std::endl;
+
+    lasd::PQHeap<long, Arity> pq;
+    Report("PQHeap Insert", n, Measure([&pq, &keys, n]() {
+      for (ulong i = 0; i < n; ++i)
+        pq.Insert(keys[i]);
+    }));
+    Report("PQHeap TipNRemove", n, Measure([&pq, n]() {
+      for (ulong i = 0; i < n; ++i)
+        pq.TipNRemove();
+    }));
+
+    lasd::HeapVec<long, Arity> heap(keys);
+    Report("HeapVec HeapSort", n, Measure([&heap]() { heap.Sort(); }));
+  }
+
+  void ArityBench()
+  {
+    std::cout << std::endl << "~*~ d-ary heap benchmark ~*~" << std::endl;
+    const ulong sizes[] = {100000, 1000000 * BENCH_SCALE};
+    for (ulong n : sizes)
+    {
+      std::cout << n << " random keys" << std::endl;
+      lasd::Vector<long> keys = RandomKeys(n);
+      ArityRun<2>(keys);
+      ArityRun<4>(keys);
+      ArityRun<8>(keys);
+    }
+  }
+
+  /* ************************************************************************ */
+
+  // String key counting how many times it is moved or copied, and compared.
+  struct Moved
+  {
+    std::string str;
+    static ulong moves; // Copies included
+    static ulong copies;
+    static ulong compares;
+
+    Moved() = default;
+    Moved(std::string s) : str(std::move(s)) {}
+    Moved(const Moved& other) : str(other.str) { moves++; copies++; }
+    Moved(Moved&& other) noexcept : str(std::move(other.str)) { moves++; }
+    Moved& operator=(const Moved& other) { str = other.str; moves++; copies++; return *this; }
+    Moved& operator=(Moved&& other) noexcept { str = std::move(other.str); moves++; return *this; }
+
+    bool operator==(const Moved& other) const { return str == other.str; }
+    bool operator!=(const Moved& other) const { return str != other.str; }
+    bool operator>(const Moved& other) const { compares++; return str > other.str; }
+    bool operator<(const Moved& other) const { compares++; return str < other.str; }
+  };
+
+  ulong Moved::moves = 0;
+  ulong Moved::copies = 0;
+  ulong Moved::compares = 0;
+
+  // The swap-chain priority queue PQHeap used before: recursive sift down and
+  // a sift up that swaps at every level, all through the checked operator[].
+  struct SwapChainPQ
+  {
+    lasd::Vector<Moved> buf;
+    ulong heapSize = 0;
+
+    void Down(ulong root)
+    {
+      ulong max = root, l = 2 * root + 1, r = 2 * root + 2;
+      if (l < heapSize && buf[l] > buf[max]) max = l;
+      if (r < heapSize && buf[r] > buf[max]) max = r;
+      if (max != root)
+      {
+        std::swap(buf[root], buf[max]);
+        Down(max);
+      }
+    }
+
+    void Insert(const Moved& dat)
+    {
+      if (heapSize == buf.Size())
+        buf.Resize(std::max<ulong>(10, 2 * heapSize));
+      ulong child = heapSize++;
+      buf[child] = dat;
+      while (child > 0 && buf[child] > buf[(child - 1) / 2])
+      {
+        std::swap(buf[child], buf[(child - 1) / 2]);
+        child = (child - 1) / 2;
+      }
+    }
+
+    Moved TipNRemove()
+    {
+      Moved tip = buf[0];
+      std::swap(buf[0], buf[--heapSize]);
+      Down(0);
+      return tip;
+    }
+  };
+
+  lasd::Vector<Moved> RandomStrings(ulong n)
+  {
+    std::mt19937 gen(BENCH_SEED);
+    std::uniform_int_distribution<int> letter('a', 'z');
+    lasd::Vector<Moved> keys(n);
+    keys.Map([&gen, &letter](Moved& dat) {
+      std::string str(24, ' ');
+      for (char& c : str)
+        c = letter(gen);
+      dat = Moved(str);
+    });
+    return keys;
+  }
+
+  template <typename Queue>
+  void DrainStrings(const std::string& name, Queue& pq, const lasd::Vector<Moved>& keys, std::string& checksum)
+  {
+    ulong n = keys.Size();
+    ulong before = Moved::moves;
+    double ms = Measure([&pq, &keys, &checksum, n]() {
+      for (ulong i = 0; i < n; ++i)
+        pq.Insert(keys[i]);
+      for (ulong i = 0; i < n; ++i)
+        checksum += pq.TipNRemove().str[0];
+    });
+    Report(name + " insert + drain", 2 * n, ms);
+    std::cout << "    string moves/copies: " << (Moved::moves - before) << " (" << (static_cast<double>(Moved::moves - before) / n) << " per key)" << std::endl;
+  }
+
+  void HoleBench()
+  {
+    std::cout << std::endl << "~*~ Hole-based sift benchmark ~*~" << std::endl;
+    const ulong n = 100000 * BENCH_SCALE;
+    std::cout << "PQHeap of " << n << " 24-char strings" << std::endl;
+    lasd::Vector<Moved> keys = RandomStrings(n);
+
+    std::string swapOrder, holeOrder;
+    SwapChainPQ swapChain;
+    DrainStrings("Swap chain (previous PQHeap)", swapChain, keys, swapOrder);
+    lasd::PQHeap<Moved> pq;
+    DrainStrings("Hole-based PQHeap", pq, keys, holeOrder);
+    Check("Both queues pop the same order", swapOrder == holeOrder);
+  }
+
+  /* ************************************************************************ */
+
+  template <typename Heap>
+  void SortRun(const std::string& name, Heap& heap, void (Heap::*sort)() noexcept)
+  {
+    ulong n = heap.Size();
+    ulong before = Moved::compares;
+    Report(name, n, Measure([&heap, sort]() { (heap.*sort)(); }));
+    std::cout << "    comparisons: " << (Moved::compares - before) << " (" << (static_cast<double>(Moved::compares - before) / n) << " per key)" << std::endl;
+  }
+
+  template <ulong Arity>
+  void BottomUpRun(const lasd::Vector<Moved>& keys)
+  {
+    std::cout << " " << Arity << "-ary HeapVec" << std::endl;
+    lasd::HeapVec<Moved, Arity> topDown(keys);
+    lasd::HeapVec<Moved, Arity> bottomUp(keys);
+    SortRun("Top-down heapsort", topDown, &lasd::HeapVec<Moved, Arity>::TopDownSort);
+    SortRun("Bottom-up heapsort", bottomUp, &lasd::HeapVec<Moved, Arity>::Sort);
+    Check("Both heapsorts agree", SameOrderedContents(topDown, bottomUp));
+  }
+
+  void BottomUpBench()
+  {
+    std::cout << std::endl << "~*~ Bottom-up heapsort benchmark ~*~" << std::endl;
+    const ulong n = 100000 * BENCH_SCALE;
+    std::cout << n << " 24-char strings" << std::endl;
+    lasd::Vector<Moved> keys = RandomStrings(n);
+    BottomUpRun<2>(keys);
+    BottomUpRun<4>(keys);
+  }
+
+  /* ************************************************************************ */
+
+  // The adaptor min-priority users had to wrap their keys in before PQHeap
+  // took a comparator.
+  struct Negated
+  {
+    long val = 0;
+
+    bool operator==(const Negated& other) const { return val == other.val; }
+    bool operator!=(const Negated& other) const { return val != other.val; }
+    bool operator>(const Negated& other) const { return val < other.val; }
+    bool operator<(const Negated& other) const { return val > other.val; }
+  };
+
+  void ComparatorBench()
+  {
+    std::cout << std::endl << "~*~ Comparator policy benchmark ~*~" << std::endl;
+    const ulong n = 1000000 * BENCH_SCALE;
+    std::cout << "Min-priority queue of " << n << " random keys" << std::endl;
+    lasd::Vector<long> keys = RandomKeys(n);
+
+    long adaptorSum = 0, comparatorSum = 0;
+    bool adaptorAsc = true, comparatorAsc = true;
+    lasd::PQHeap<Negated> adaptor;
+    Report("Negating adaptor", 2 * n, Measure([&]() {
+      for (ulong i = 0; i < n; ++i)
+        adaptor.Insert(Negated{keys[i]});
+      long prev = adaptor.Tip().val;
+      for (ulong i = 0; i < n; ++i)
+      {
+        long cur = adaptor.TipNRemove().val;
+        adaptorAsc = adaptorAsc && prev <= cur;
+        adaptorSum += cur * static_cast<long>(i % 7);
+        prev = cur;
+      }
+    }));
+    lasd::PQHeap<long, 2, std::greater<long>> minPQ;
+    Report("std::greater comparator", 2 * n, Measure([&]() {
+      for (ulong i = 0; i < n; ++i)
+        minPQ.Insert(keys[i]);
+      long prev = minPQ.Tip();
+      for (ulong i = 0; i < n; ++i)
+      {
+        long cur = minPQ.TipNRemove();
+        comparatorAsc = comparatorAsc && prev <= cur;
+        comparatorSum += cur * static_cast<long>(i % 7);
+        prev = cur;
+      }
+    }));
+    Check("Both queues pop keys in ascending order", adaptorAsc && comparatorAsc && adaptorSum == comparatorSum);
+  }
+
+  /* ************************************************************************ */
+
+  // Synthetic sparse graph in compressed adjacency form: a ring through all
+  // nodes, so that everything is reachable, plus random chords.
+  struct Graph
+  {
+    ulong nodes = 0;
+    lasd::Vector<ulong> first; // Edges of node v are first[v] .. first[v+1]-1
+    lasd::Vector<ulong> target;
+    lasd::Vector<long> weight;
+  };
+
+  Graph RandomGraph(ulong n, ulong chords)
+  {
+    std::mt19937 gen(BENCH_SEED);
+    std::uniform_int_distribution<ulong> node(0, n - 1);
+    std::uniform_int_distribution<long> cost(1, 1000);
+    Graph g;
+    g.nodes = n;
+    g.first = lasd::Vector<ulong>(n + 1);
+    g.target = lasd::Vector<ulong>(n * (chords + 1));
+    g.weight = lasd::Vector<long>(n * (chords + 1));
+    ulong e = 0;
+    for (ulong v = 0; v < n; ++v)
+    {
+      g.first[v] = e;
+      g.target[e] = (v + 1) % n;
+      g.weight[e++] = cost(gen);
+      for (ulong k = 0; k < chords; ++k)
+      {
+        g.target[e] = node(gen);
+        g.weight[e++] = cost(gen);
+      }
+    }
+    g.first[n] = e;
+    return g;
+  }
+
+  using Label = std::pair<long, ulong>; // Tentative distance, node
+  using NearestLabel = std::greater<Label>;
+
+  // Dijkstra with decrease-key: every node is queued at most once.
+  lasd::Vector<long> DijkstraAddr(const Graph& g, ulong& peak)
+  {
+    using Queue = lasd::PQAddr<Label, 4, NearestLabel>;
+    lasd::Vector<long> dist(g.nodes);
+    lasd::Vector<typename Queue::Handle> handle(g.nodes);
+    lasd::Vector<char> state(g.nodes); // 0 unseen, 1 queued, 2 settled
+    dist.Map([](long& d) { d = -1; });
+    state.Map([](char& s) { s = 0; });
+    Queue pq;
+    pq.Reserve(g.nodes);
+    dist[0] = 0;
+    handle[0] = pq.Push(Label(0, 0));
+    state[0] = 1;
+    peak = 1;
+    while (!pq.Empty())
+    {
+      Label cur = pq.TipNRemove();
+      ulong v = cur.second;
+      state[v] = 2;
+      for (ulong e = g.first[v]; e < g.first[v + 1]; ++e)
+      {
+        ulong w = g.target[e];
+        long nd = cur.first + g.weight[e];
+        if (state[w] == 0)
+        {
+          dist[w] = nd;
+          handle[w] = pq.Push(Label(nd, w));
+          state[w] = 1;
+        }
+        else if (state[w] == 1 && nd < dist[w])
+        {
+          dist[w] = nd;
+          pq.Change(handle[w], Label(nd, w));
+        }
+      }
+      peak = std::max(peak, pq.Size());
+    }
+    return dist;
+  }
+
+  // Dijkstra as it had to be written on PQHeap: push a new label on every
+  // improvement and skip the stale ones when they surface.
+  template <typename Queue = lasd::PQHeap<Label, 4, NearestLabel>>
+  lasd::Vector<long> DijkstraLazy(const Graph& g, ulong& peak)
+  {
+    lasd::Vector<long> dist(g.nodes);
+    lasd::Vector<char> settled(g.nodes);
+    dist.Map([](long& d) { d = -1; });
+    settled.Map([](char& s) { s = 0; });
+    Queue pq;
+    dist[0] = 0;
+    pq.Insert(Label(0, 0));
+    peak = 1;
+    while (!pq.Empty())
+    {
+      Label cur = pq.TipNRemove();
+      ulong v = cur.second;
+      if (settled[v])
+        continue;
+      settled[v] = 1;
+      for (ulong e = g.first[v]; e < g.first[v + 1]; ++e)
+      {
+        ulong w = g.target[e];
+        long nd = cur.first + g.weight[e];
+        if (!settled[w] && (dist[w] < 0 || nd < dist[w]))
+        {
+          dist[w] = nd;
+          pq.Insert(Label(nd, w));
+        }
+      }
+      peak = std::max(peak, pq.Size());
+    }
+    return dist;
+  }
+
+  void AddressableBench()
+  {
+    std::cout << std::endl << "~*~ Addressable priority queue benchmark ~*~" << std::endl;
+    const ulong n = 1000000 * BENCH_SCALE;
+    Graph g = RandomGraph(n, 3);
+    std::cout << "Dijkstra on " << n << " nodes, " << g.target.Size() << " edges" << std::endl;
+    ulong lazyPeak = 0, addrPeak = 0;
+    lasd::Vector<long> lazy, addr;
+    Report("PQHeap with lazy deletion", n, Measure([&]() { lazy = DijkstraLazy(g, lazyPeak); }));
+    std::cout << "    peak queue size: " << lazyPeak << std::endl;
+    Report("PQAddr with decrease-key", n, Measure([&]() { addr = DijkstraAddr(g, addrPeak); }));
+    std::cout << "    peak queue size: " << addrPeak << std::endl;
+    Check("Both find the same distances", lazy == addr);
+    Check("Decrease-key queues each node at most once", addrPeak <= n);
+  }
+
+  /* ************************************************************************ */
+
+  // Mixed trace: half the operations raise the priority of a random queued
+  // element, a quarter insert and a quarter pop.
+  struct Trace
+  {
+    ulong initial = 0;
+    lasd::Vector<char> op; // 'c'hange, 'i'nsert, 'p'op
+    lasd::Vector<ulong> pick;
+    lasd::Vector<long> amount;
+  };
+
+  Trace MixedTrace(ulong initial, ulong ops)
+  {
+    std::mt19937 gen(BENCH_SEED);
+    std::uniform_int_distribution<int> kind(0, 3);
+    std::uniform_int_distribution<ulong> any(0, ~0UL);
+    std::uniform_int_distribution<long> raise(1, 1L << 40);
+    Trace t;
+    t.initial = initial;
+    t.op = lasd::Vector<char>(ops);
+    t.pick = lasd::Vector<ulong>(ops);
+    t.amount = lasd::Vector<long>(ops);
+    for (ulong i = 0; i < ops; ++i)
+    {
+      int k = kind(gen);
+      t.op[i] = (k < 2) ? 'c' : ((k == 2) ? 'i' : 'p');
+      t.pick[i] = any(gen);
+      t.amount[i] = raise(gen);
+    }
+    return t;
+  }
+
+  // Runs the trace through a queue addressed by handles. Queued elements are
+  // tracked by id in a dense array, so that a random one can be picked.
+  template <typename Queue>
+  long RunHandles(const Trace& t, const lasd::Vector<long>& keys)
+  {
+    ulong cap = t.initial + t.op.Size();
+    Queue pq;
+    lasd::Vector<typename Queue::Handle> handle(cap);
+    lasd::Vector<ulong> liveIds(cap), where(cap);
+    ulong numLive = 0, nextId = 0;
+    long checksum = 0;
+    auto push = [&](long prio) {
+      ulong id = nextId++;
+      handle[id] = pq.Push(Label(prio, id));
+      where[id] = numLive;
+      liveIds[numLive++] = id;
+    };
+    for (ulong i = 0; i < t.initial; ++i)
+      push(keys[i]);
+    for (ulong i = 0; i < t.op.Size(); ++i)
+    {
+      if (t.op[i] == 'i' || numLive == 0)
+        push(keys[i % keys.Size()]);
+      else if (t.op[i] == 'c')
+      {
+        ulong id = liveIds[t.pick[i] % numLive];
+        pq.Change(handle[id], Label(pq[handle[id]].first + t.amount[i], id));
+      }
+      else
+      {
+        Label top = pq.TipNRemove();
+        checksum = checksum * 31 + top.first;
+        ulong id = top.second;
+        ulong last = liveIds[--numLive];
+        liveIds[where[id]] = last;
+        where[last] = where[id];
+      }
+    }
+    while (!pq.Empty())
+      checksum = checksum * 31 + pq.TipNRemove().first;
+    return checksum;
+  }
+
+  // The same trace on PQHeap, which can only name elements by position: a
+  // random position is raised instead of a random element.
+  long RunPositions(const Trace& t, const lasd::Vector<long>& keys)
+  {
+    lasd::PQHeap<Label> pq;
+    const lasd::PQ<Label>& view = pq;
+    ulong nextId = 0;
+    long checksum = 0;
+    for (ulong i = 0; i < t.initial; ++i)
+      pq.Insert(Label(keys[i], nextId++));
+    for (ulong i = 0; i < t.op.Size(); ++i)
+    {
+      if (t.op[i] == 'i' || pq.Empty())
+        pq.Insert(Label(keys[i % keys.Size()], nextId++));
+      else if (t.op[i] == 'c')
+      {
+        ulong at = t.pick[i] % pq.Size();
+        Label cur = view[at];
+        pq.Change(at, Label(cur.first + t.amount[i], cur.second));
+      }
+      else
+        checksum = checksum * 31 + pq.TipNRemove().first;
+    }
+    while (!pq.Empty())
+      checksum = checksum * 31 + pq.TipNRemove().first;
+    return checksum;
+  }
+
+  void PairingBench()
+  {
+    std::cout << std::endl << "~*~ Pairing heap benchmark ~*~" << std::endl;
+    const ulong initial = 100000 * BENCH_SCALE, ops = 1000000 * BENCH_SCALE;
+    std::cout << "Mixed trace: " << initial << " initial keys, " << ops << " operations (50% change, 25% insert, 25% pop)" << std::endl;
+    Trace t = MixedTrace(initial, ops);
+    lasd::Vector<long> keys = RandomKeys(initial + ops);
+    long heapSum = 0, addrSum = 0, pairSum = 0;
+    Report("PQHeap (change by position)", ops, Measure([&]() { heapSum = RunPositions(t, keys); }));
+    Report("PQAddr (change by handle)", ops, Measure([&]() { addrSum = RunHandles<lasd::PQAddr<Label>>(t, keys); }));
+    Report("PQPairing (change by handle)", ops, Measure([&]() { pairSum = RunHandles<lasd::PQPairing<Label>>(t, keys); }));
+    std::cout << "    (PQHeap checksum " << heapSum << " differs by design: it raises positions, not elements)" << std::endl;
+    Check("PQPairing pops what PQAddr pops", addrSum == pairSum);
+
+    const ulong half = 500000 * BENCH_SCALE;
+    lasd::PQPairing<long> big(RandomKeys(half, BENCH_SEED + 3)), other(RandomKeys(half, BENCH_SEED + 4));
+    Report("Meld of two " + std::to_string(half) + "-key queues", 1, Measure([&]() { big.Meld(std::move(other)); }));
+  }
+
+  /* ************************************************************************ */
+
+  // The double-ended queue min-max users had to build before: a max PQHeap
+  // and a min PQHeap over the same elements, each skipping the entries
+  // already taken out through the other one.
+  struct TwinHeaps
+  {
+    lasd::PQHeap<Label> high;
+    lasd::PQHeap<Label, 2, std::greater<Label>> low;
+    lasd::Vector<char> gone;
+    ulong nextId = 0, live = 0;
+
+    TwinHeaps(ulong cap) : gone(cap) {}
+
+    void Insert(long key)
+    {
+      high.Insert(Label(key, nextId));
+      low.Insert(Label(key, nextId));
+      gone[nextId++] = 0;
+      live++;
+    }
+
+    long MaxNRemove()
+    {
+      while (gone[high.Tip().second])
+        high.RemoveTip();
+      Label top = high.TipNRemove();
+      gone[top.second] = 1;
+      live--;
+      return top.first;
+    }
+
+    long MinNRemove()
+    {
+      while (gone[low.Tip().second])
+        low.RemoveTip();
+      Label top = low.TipNRemove();
+      gone[top.second] = 1;
+      live--;
+      return top.first;
+    }
+
+    ulong Held() const { return high.Size() + low.Size(); }
+  };
+
+  void MinMaxBench()
+  {
+    std::cout << std::endl << "~*~ Min-max heap benchmark ~*~" << std::endl;
+    const ulong initial = 100000 * BENCH_SCALE, ops = 1000000 * BENCH_SCALE;
+    std::cout << initial << " initial keys, " << ops << " operations (50% insert, 25% pop max, 25% pop min)" << std::endl;
+    lasd::Vector<long> keys = RandomKeys(initial + ops);
+    Trace t = MixedTrace(0, ops);
+
+    long twinSum = 0, minMaxSum = 0;
+    ulong twinHeld = 0, minMaxHeld = 0;
+    Report("Two synchronized PQHeaps", ops, Measure([&]() {
+      TwinHeaps pq(initial + ops);
+      for (ulong i = 0; i < initial; ++i)
+        pq.Insert(keys[i]);
+      for (ulong i = 0; i < ops; ++i)
+      {
+        if (t.op[i] == 'c' || pq.live == 0)
+          pq.Insert(keys[initial + i]);
+        else
+          twinSum = twinSum * 31 + ((t.op[i] == 'i') ? pq.MaxNRemove() : pq.MinNRemove());
+        twinHeld = std::max(twinHeld, pq.Held());
+      }
+    }));
+    std::cout << "    peak elements held: " << twinHeld << std::endl;
+    Report("PQMinMax", ops, Measure([&]() {
+      lasd::PQMinMax<long> pq;
+      for (ulong i = 0; i < initial; ++i)
+        pq.Insert(keys[i]);
+      for (ulong i = 0; i < ops; ++i)
+      {
+        if (t.op[i] == 'c' || pq.Empty())
+          pq.Insert(keys[initial + i]);
+        else
+          minMaxSum = minMaxSum * 31 + ((t.op[i] == 'i') ? pq.MaxNRemove() : pq.MinNRemove());
+        minMaxHeld = std::max(minMaxHeld, pq.Size());
+      }
+    }));
+    std::cout << "    peak elements held: " << minMaxHeld << std::endl;
+    Check("Both pop the same keys", twinSum == minMaxSum);
+
+    lasd::Vector<long> big = RandomKeys(1000000 * BENCH_SCALE);
+    lasd::PQMinMax<long>* built = nullptr;
+    Report("Linear-time build from 10^6 keys", big.Size(), Measure([&]() { built = new lasd::PQMinMax<long>(big); }));
+    delete built;
+  }
+
+  /* ************************************************************************ */
+
+  struct LabelKey
+  {
+    ulong operator()(const Label& lab) const noexcept { return static_cast<ulong>(lab.first); }
+  };
+
+  // Discrete-event simulation: popping the next event at time t schedules
+  // one to three events at t plus a random delay.
+  template <typename Queue>
+  ulong Simulate(Queue& pq, ulong initial, ulong ops, ulong& checksum)
+  {
+    std::mt19937 gen(BENCH_SEED);
+    std::uniform_int_distribution<ulong> delay(1, 1000000);
+    std::uniform_int_distribution<int> fanout(0, 2);
+    for (ulong i = 0; i < initial; ++i)
+      pq.Insert(delay(gen));
+    ulong peak = pq.Size();
+    checksum = 0;
+    for (ulong i = 0; i < ops && !pq.Empty(); ++i)
+    {
+      ulong now = pq.TipNRemove();
+      checksum = checksum * 31 + now;
+      for (int k = fanout(gen) + (pq.Size() < initial); k > 0; --k)
+        pq.Insert(now + delay(gen));
+      peak = std::max(peak, pq.Size());
+    }
+    return peak;
+  }
+
+  void RadixBench()
+  {
+    std::cout << std::endl << "~*~ Radix heap benchmark ~*~" << std::endl;
+    const ulong initial = 100000 * BENCH_SCALE, ops = 2000000 * BENCH_SCALE;
+    std::cout << "Event simulation: " << initial << " pending events, " << ops << " pops" << std::endl;
+    ulong heapSum = 0, radixSum = 0;
+    Report("PQHeap<ulong, 4, greater>", ops, Measure([&]() {
+      lasd::PQHeap<ulong, 4, std::greater<ulong>> pq;
+      Simulate(pq, initial, ops, heapSum);
+    }));
+    Report("PQRadix<ulong>", ops, Measure([&]() {
+      lasd::PQRadix<ulong> pq;
+      Simulate(pq, initial, ops, radixSum);
+    }));
+    Check("Both pop the same times", heapSum == radixSum);
+
+    const ulong n = 1000000 * BENCH_SCALE;
+    Graph g = RandomGraph(n, 3);
+    std::cout << "Dijkstra on " << n << " nodes, " << g.target.Size() << " edges" << std::endl;
+    ulong heapPeak = 0, radixPeak = 0;
+    lasd::Vector<long> heap, radix;
+    Report("PQHeap with lazy deletion", n, Measure([&]() { heap = DijkstraLazy(g, heapPeak); }));
+    Report("PQRadix with lazy deletion", n, Measure([&]() { radix = DijkstraLazy<lasd::PQRadix<Label, LabelKey>>(g, radixPeak); }));
+    Check("Both find the same distances", heap == radix);
+  }
+
+  /* ************************************************************************ */
+
+  // Rounds of k insertions followed by k pops, on a queue of n elements
+  // whose storage has already grown to fit them. Only the insertions and the
+  // first pop, which merges the batch in, are timed.
+  template <typename Queue, typename Push>
+  long BatchRounds(Queue& pq, const lasd::Vector<long>& batch, ulong rounds, Push push, double& ms)
+  {
+    long sum = 0;
+    ms = 0;
+    for (ulong r = 0; r < rounds; ++r)
+    {
+      ms += Measure([&]() {
+        push(pq, batch);
+        sum = sum * 31 + pq.TipNRemove();
+      });
+      for (ulong i = 1; i < batch.Size(); ++i)
+        sum = sum * 31 + pq.TipNRemove();
+    }
+    return sum;
+  }
+
+  void BatchRun(const std::string& order, ulong n, const lasd::Vector<long>& batch)
+  {
+    const ulong k = batch.Size(), rounds = std::max(1UL, n / k);
+    auto one = [](lasd::PQHeap<long>& pq, const lasd::Vector<long>& b) { for (ulong i = 0; i < b.Size(); ++i) pq.Insert(b[i]); };
+    auto all = [](lasd::PQHeap<long>& pq, const lasd::Vector<long>& b) { pq.InsertAll(b); };
+    lasd::PQHeap<long> onePQ(RandomKeys(n)), allPQ(RandomKeys(n));
+    double oneMs = 0, allMs = 0;
+    BatchRounds(onePQ, batch, 1, one, oneMs);
+    BatchRounds(allPQ, batch, 1, all, allMs);
+    std::cout << "  " << order << " batches of " << k << " into " << n << ", " << rounds << " rounds:" << std::endl;
+    long oneSum = BatchRounds(onePQ, batch, rounds, one, oneMs);
+    Report("  Insert one by one", rounds * k, oneMs);
+    long allSum = BatchRounds(allPQ, batch, rounds, all, allMs);
+    Report("  InsertAll", rounds * k, allMs);
+    Check("Both pop the same keys", oneSum == allSum);
+  }
+
+  void BatchBench()
+  {
+    std::cout << std::endl << "~*~ Batched insertion benchmark ~*~" << std::endl;
+    const ulong n = 1000000 * BENCH_SCALE;
+    for (ulong k = n / 1000; k <= n; k *= 10)
+    {
+      BatchRun("Random", n, RandomKeys(k, k));
+      lasd::Vector<long> above(k);
+      for (ulong i = 0; i < k; ++i)
+        above[i] = (1L << 41) + i; // Each one beyond everything queued
+      BatchRun("Ascending", n, above);
+    }
+
+    // Tip scans a pending batch on every read, until a Flush merges it
+    const ulong scans = 100, reads = 100000;
+    lasd::PQHeap<long> peeked(RandomKeys(n));
+    peeked.InsertAll(RandomKeys(n / 10, BENCH_SEED + 1));
+    long pendingSum = 0, flushedSum = 0;
+    double scanMs = Measure([&]() {
+      for (ulong i = 0; i < scans; ++i)
+        pendingSum += peeked.Tip();
+    });
+    double flushMs = Measure([&]() { peeked.Flush(); });
+    double readMs = Measure([&]() {
+      for (ulong i = 0; i < reads; ++i)
+        flushedSum += peeked.Tip();
+    });
+    Report("Tip with a pending batch of " + std::to_string(n / 10), scans, scanMs);
+    Report("Flush", 1, flushMs);
+    Report("Tip after Flush", reads, readMs);
+    Check("Both read the same tip", pendingSum / static_cast<long>(scans) == flushedSum / static_cast<long>(reads));
+  }
+
+  /* ************************************************************************ */
+
+  // Rank error of every removal in a single-threaded steady state: how many
+  // queued keys were greater than the one removed, measured on a SetTVec
+  // holding the same (distinct) keys.
+  void RankError(ulong shards, ulong initial, ulong ops)
+  {
+    lasd::PQMulti<long> pq(shards, 1);
+    lasd::SetTVec<long> ref;
+    lasd::Vector<long> keys = RandomKeys(initial + ops, shards);
+    ulong next = 0;
+    for (; next < initial; ++next)
+      if (ref.Insert(keys[next]))
+        pq.Insert(keys[next]);
+    double total = 0;
+    ulong worst = 0;
+    for (ulong i = 0; i < ops; ++i)
+    {
+      long got = pq.TipNRemove();
+      ulong rank = ref.Size() - 1 - ref.Rank(got);
+      ref.Remove(got);
+      total += rank;
+      worst = std::max(worst, rank);
+      if (ref.Insert(keys[next]))
+        pq.Insert(keys[next]);
+      ++next;
+    }
+    std::cout << "  " << shards << " shards: mean rank error " << total / ops << ", max " << worst << std::endl;
+  }
+
+  // Every thread alternates inserting a random key and removing an element.
+  template <typename Insert, typename Remove>
+  double Scaling(ulong threads, ulong ops, Insert insert, Remove remove)
+  {
+    std::thread* pool = new std::thread[threads];
+    double ms = Measure([&]() {
+      for (ulong t = 0; t < threads; ++t)
+        pool[t] = std::thread([&, t]() {
+          std::minstd_rand gen(t + 1);
+          for (ulong i = 0; i < ops / threads; ++i)
+          {
+            insert(static_cast<long>(gen()));
+            remove();
+          }
+        });
+      for (ulong t = 0; t < threads; ++t)
+        pool[t].join();
+    });
+    delete[] pool;
+    return ms;
+  }
+
+  void MultiBench()
+  {
+    std::cout << std::endl << "~*~ MultiQueue benchmark ~*~" << std::endl;
+    std::cout << "Rank error (10^5 queued, 10^5 removals):" << std::endl;
+    for (ulong shards = 2; shards <= 64; shards *= 4)
+      RankError(shards, 100000, 100000);
+
+    const ulong initial = 100000, ops = 400000 * BENCH_SCALE;
+    std::cout << "Scaling (" << initial << " queued, " << ops << " insert/remove pairs in total, "
+              << std::thread::hardware_concurrency() << " hardware threads):" << std::endl;
+    lasd::Vector<long> keys = RandomKeys(initial);
+    for (ulong threads = 1; threads <= 32; threads *= 2)
+    {
+      lasd::PQHeap<long> global(keys);
+      std::mutex lock;
+      double globalMs = Scaling(threads, ops,
+        [&](long key) { std::lock_guard<std::mutex> guard(lock); global.Insert(key); },
+        [&]() { std::lock_guard<std::mutex> guard(lock); global.RemoveTip(); });
+      lasd::PQMulti<long> multi(threads);
+      for (ulong i = 0; i < initial; ++i)
+        multi.Insert(keys[i]);
+      double multiMs = Scaling(threads, ops,
+        [&](long key) { multi.Insert(key); },
+        [&]() { multi.TryTipNRemove(); });
+      std::cout << "  " << threads << " threads: PQHeap behind one mutex " << globalMs << " ms, PQMulti (" << multi.Shards() << " shards) " << multiMs << " ms" << std::endl;
+    }
+  }
+
+  /* ************************************************************************ */
+
+  // Keys of the stream, regenerated on the fly rather than stored.
+  struct Stream
+  {
+    std::mt19937_64 gen{BENCH_SEED};
+    long Next() { return static_cast<long>(gen() >> 1); }
+  };
+
+  void TopKBench()
+  {
+    std::cout << std::endl << "~*~ Bounded top-K benchmark ~*~" << std::endl;
+    // 10^8 items at BENCH_SCALE 10.
+    const ulong n = 10000000 * BENCH_SCALE, kSmall = 100, kLarge = 100000;
+    std::cout << n << " streamed keys" << std::endl;
+    lasd::Vector<long> heapSmall(kSmall), heapLarge(kLarge);
+    {
+      lasd::PQHeap<long> pq;
+      Stream s;
+      double insertMs = Measure([&]() {
+        for (ulong i = 0; i < n; ++i)
+          pq.Insert(s.Next());
+      });
+      std::cout << "  PQHeap holding all " << pq.Size() << " keys:" << std::endl;
+      double popMs = Measure([&]() {
+        for (ulong i = 0; i < kSmall; ++i)
+          heapSmall[i] = heapLarge[i] = pq.TipNRemove();
+      });
+      Report("  insert all, pop K = 10^2", n, insertMs + popMs);
+      popMs += Measure([&]() {
+        for (ulong i = kSmall; i < kLarge; ++i)
+          heapLarge[i] = pq.TipNRemove();
+      });
+      Report("  insert all, pop K = 10^5", n, insertMs + popMs);
+    }
+    for (ulong k : {kSmall, kLarge})
+    {
+      lasd::Vector<long> top;
+      ulong kept = 0;
+      Report("PQTopK, K = " + std::to_string(k) + ", then Sorted()", n, Measure([&]() {
+        lasd::PQTopK<long> best(k);
+        Stream s;
+        for (ulong i = 0; i < n; ++i)
+          kept += best.Insert(s.Next());
+        top = best.Sorted();
+      }));
+      std::cout << "    " << kept << " keys entered the top " << k << std::endl;
+      Check("Same top keys as PQHeap", top == (k == kSmall ? heapSmall : heapLarge));
+    }
+  }
+
+  /* ************************************************************************ */
+
+  void PopKRun(const lasd::Vector<Moved>& keys, ulong k)
+  {
+    const ulong n = keys.Size();
+    std::cout << "  k = " << k << " of " << n << ":" << std::endl;
+    lasd::PQHeap<Moved> one(keys), all(keys);
+    lasd::Vector<Moved> oneOut(k), allOut;
+    ulong copies = Moved::copies;
+    Report("  Tip copy + RemoveTip (previous TipNRemove)", k, Measure([&]() {
+      for (ulong i = 0; i < k; ++i)
+      {
+        oneOut[i] = one.Tip();
+        one.RemoveTip();
+      }
+    }));
+    std::cout << "      string copies: " << (Moved::copies - copies) << std::endl;
+    copies = Moved::copies;
+    Report("  TipNRemove(k)", k, Measure([&]() { allOut = all.TipNRemove(k); }));
+    std::cout << "      string copies: " << (Moved::copies - copies) << std::endl;
+    Check("Same elements in the same order", oneOut == allOut && one.Size() == all.Size());
+  }
+
+  void PopKBench()
+  {
+    std::cout << std::endl << "~*~ Batch TipNRemove benchmark ~*~" << std::endl;
+    const ulong n = 1000000 * BENCH_SCALE;
+    lasd::Vector<Moved> keys = RandomStrings(n);
+    for (ulong k = 100; k <= n; k *= 10)
+      PopKRun(keys, k);
+    PopKRun(keys, n / 2);
+  }
+
+  /* ************************************************************************ */
+
+  // A job of the scheduler: a priority out of a few levels and an id, given
+  // in submission order.
+  struct Job
+  {
+    long priority = 0;
+    ulong id = 0;
+
+    bool operator==(const Job& other) const { return priority == other.priority && id == other.id; }
+    bool operator!=(const Job& other) const { return !(*this == other); }
+  };
+
+  struct ByPriority
+  {
+    bool operator()(const Job& sx, const Job& dx) const noexcept { return sx.priority < dx.priority; }
+  };
+
+  // The wrapping schedulers had to do: a 64-bit sequence number inside every
+  // element, breaking ties in favour of the earlier one.
+  struct Sequenced
+  {
+    Job job;
+    ulong seq = 0;
+
+    bool operator==(const Sequenced& other) const { return job == other.job && seq == other.seq; }
+    bool operator<(const Sequenced& other) const
+    {
+      return job.priority < other.job.priority || (job.priority == other.job.priority && seq > other.seq);
+    }
+  };
+
+  using BySequencedPriority = std::less<Sequenced>;
+
+  struct WrappedScheduler
+  {
+    lasd::PQHeap<Sequenced, 2, BySequencedPriority> pq;
+    ulong seq = 0;
+
+    void Insert(const Job& job) { pq.Insert(Sequenced{job, seq++}); }
+    Job TipNRemove() { return pq.TipNRemove().job; }
+    ulong Size() const { return pq.Size(); }
+    bool Empty() const { return pq.Empty(); }
+  };
+
+  // Submissions and dispatches interleaved at random over few priority
+  // levels; returns a checksum of the dispatch order and checks that equal
+  // priorities are dispatched in submission order.
+  template <typename Queue>
+  ulong Schedule(Queue& pq, ulong initial, ulong ops, ulong levels, bool& fifo)
+  {
+    std::mt19937 gen(BENCH_SEED);
+    std::uniform_int_distribution<long> level(0, levels - 1);
+    lasd::Vector<ulong> lastId(levels);
+    lastId.Map([](ulong& id) { id = 0; });
+    ulong id = 0, sum = 0;
+    fifo = true;
+    for (; id < initial; ++id)
+      pq.Insert(Job{level(gen), id + 1});
+    for (ulong i = 0; i < ops; ++i)
+    {
+      if (pq.Empty() || gen() % 2 == 0)
+      {
+        pq.Insert(Job{level(gen), id + 1});
+        ++id;
+      }
+      else
+      {
+        Job job = pq.TipNRemove();
+        fifo = fifo && job.id > lastId[job.priority];
+        lastId[job.priority] = job.id;
+        sum = sum * 31 + job.id;
+      }
+    }
+    return sum;
+  }
+
+  void StableBench()
+  {
+    std::cout << std::endl << "~*~ Stable priority queue benchmark ~*~" << std::endl;
+    const ulong initial = 1000000 * BENCH_SCALE, ops = 2000000 * BENCH_SCALE, levels = 8;
+    std::cout << initial << " queued jobs, " << ops << " submissions and dispatches over " << levels << " priorities" << std::endl;
+    bool wrappedFifo = false, stableFifo = false;
+    ulong wrappedSum = 0, stableSum = 0;
+    Report("PQHeap of jobs wrapped with a 64-bit sequence", ops, Measure([&]() {
+      WrappedScheduler pq;
+      wrappedSum = Schedule(pq, initial, ops, levels, wrappedFifo);
+    }));
+    std::cout << "    bytes per queued job: " << sizeof(Sequenced) << std::endl;
+    Report("PQStable with a 32-bit arrival lane", ops, Measure([&]() {
+      lasd::PQStable<Job, 2, ByPriority> pq;
+      stableSum = Schedule(pq, initial, ops, levels, stableFifo);
+    }));
+    std::cout << "    bytes per queued job: " << sizeof(Job) + sizeof(std::uint32_t) << std::endl;
+    Check("Both dispatch in FIFO order within a priority", wrappedFifo && stableFifo);
+    Check("Both dispatch the same jobs", wrappedSum == stableSum);
+  }
+
+  /* ************************************************************************ */
+
+  ulong Resident(const lasd::PQHeap<long>& pq) { return pq.Size(); }
+  ulong Resident(const lasd::PQExt<long>& pq) { return pq.Resident(); }
+
+  // A backlog built up, then worked through with one new event for every
+  // three handled, then drained.
+  template <typename Queue>
+  ulong Backlog(Queue& pq, const lasd::Vector<long>& keys, ulong& peak)
+  {
+    const ulong n = keys.Size() - keys.Size() / 4;
+    ulong sum = 0, next = 0;
+    peak = 0;
+    for (; next < n; ++next)
+    {
+      pq.Insert(keys[next]);
+      peak = std::max(peak, Resident(pq));
+    }
+    for (ulong i = 0; next < keys.Size(); ++i)
+    {
+      if (i % 4 == 3)
+        pq.Insert(keys[next++]);
+      else
+        sum = sum * 31 + pq.TipNRemove();
+      peak = std::max(peak, Resident(pq));
+    }
+    while (!pq.Empty())
+      sum = sum * 31 + pq.TipNRemove();
+    return sum;
+  }
+
+  void ExtBench()
+  {
+    std::cout << std::endl << "~*~ External-memory priority queue benchmark ~*~" << std::endl;
+    const ulong n = 2000000 * BENCH_SCALE, capacity = n / 20, block = 4096;
+    lasd::Vector<long> keys = RandomKeys(n);
+    std::cout << n - n / 4 << " queued events, then " << n / 4 << " more arriving while " << 3 * (n / 4) << " are handled;"
+              << " PQExt keeps " << capacity << " in memory (runs in the temporary directory)" << std::endl;
+    ulong heapSum = 0, extSum = 0, heapPeak = 0, extPeak = 0;
+    Report("PQHeap, all in memory", n, Measure([&]() {
+      lasd::PQHeap<long> pq;
+      heapSum = Backlog(pq, keys, heapPeak);
+    }));
+    std::cout << "    peak elements in memory: " << heapPeak << std::endl;
+    Report("PQExt", n, Measure([&]() {
+      lasd::PQExt<long> pq(capacity, std::filesystem::temp_directory_path(), block, 4);
+      extSum = Backlog(pq, keys, extPeak);
+    }));
+    std::cout << "    peak elements in memory: " << extPeak << std::endl;
+    Check("Both hand out the same events", heapSum == extSum);
+    Check("PQExt stays within the heap bound plus one block per run", extPeak <= capacity + 4 * block);
+  }
+
+  /* ************************************************************************ */
+
+  struct Timer
+  {
+    ulong deadline = 0;
+    ulong id = 0;
+    bool operator==(const Timer&) const noexcept = default;
+    bool operator<(const Timer& other) const noexcept { return deadline < other.deadline || (deadline == other.deadline && id < other.id); }
+  };
+
+  struct TimerKey
+  {
+    ulong operator()(const Timer& tim) const noexcept { return tim.deadline; }
+  };
+
+  struct Earlier
+  {
+    bool operator()(const Timer& sx, const Timer& dx) const noexcept { return sx.deadline > dx.deadline; }
+  };
+
+  // Mostly timeouts of up to a minute in milliseconds, with one in a hundred
+  // a few months ahead: past the span of the wheel.
+  ulong TimerDelay(std::mt19937_64& gen)
+  {
+    return (gen() % 100 == 0) ? (1UL << 32) + gen() % (1UL << 34) : 1 + gen() % 60000;
+  }
+
+  // Fires the earliest timer and arms it again, ops times, over timers
+  // already armed; the deadlines fired go into an ordered checksum.
+  template <typename Queue>
+  ulong Fire(Queue& pq, ulong timers, ulong ops)
+  {
+    std::mt19937_64 gen(BENCH_SEED);
+    for (ulong i = 0; i < timers; ++i)
+      pq.Insert(Timer{TimerDelay(gen), i});
+    ulong sum = 0;
+    for (ulong i = 0; i < ops; ++i)
+    {
+      Timer tim = pq.TipNRemove();
+      sum = sum * 31 + tim.deadline;
+      tim.deadline += TimerDelay(gen);
+      pq.Insert(tim);
+    }
+    return sum;
+  }
+
+  void WheelBench()
+  {
+    std::cout << std::endl << "~*~ Timing wheel benchmark ~*~" << std::endl;
+    const ulong timers = 1000000 * BENCH_SCALE, ops = 5000000 * BENCH_SCALE;
+    std::cout << timers << " armed timers, " << ops << " fired and re-armed" << std::endl;
+    ulong heapSum = 0, radixSum = 0, wheelSum = 0, overflowing = 0;
+    Report("PQHeap<Timer, 4> by deadline", ops, Measure([&]() {
+      lasd::PQHeap<Timer, 4, Earlier> pq;
+      heapSum = Fire(pq, timers, ops);
+    }));
+    Report("PQRadix<Timer>", ops, Measure([&]() {
+      lasd::PQRadix<Timer, TimerKey> pq;
+      radixSum = Fire(pq, timers, ops);
+    }));
+    Report("PQWheel<Timer>", ops, Measure([&]() {
+      lasd::PQWheel<Timer, TimerKey> pq;
+      wheelSum = Fire(pq, timers, ops);
+      overflowing = pq.Overflowing();
+    }));
+    std::cout << "    timers past the wheel at the end: " << overflowing << std::endl;
+    Check("All fire the same deadlines", heapSum == radixSum && heapSum == wheelSum);
+  }
+
+  /* ************************************************************************ */
+
+  // Key type counting the buffers allocated for it: Vector and SmallVector
+  // both take their heap buffers from new Data[n].
+  struct Tracked
+  {
+    long key = 0;
+    static ulong buffers;
+
+    static void* operator new[](std::size_t bytes) { buffers++; return ::operator new[](bytes); }
+    static void operator delete[](void* ptr) noexcept { ::operator delete[](ptr); }
+
+    bool operator==(const Tracked&) const noexcept = default;
+    bool operator<(const Tracked& other) const noexcept { return key < other.key; }
+    bool operator>(const Tracked& other) const noexcept { return key > other.key; }
+  };
+
+  ulong Tracked::buffers = 0;
+
+  // Short-lived vectors, mostly short: each is filled, grown by two
+  // elements, copied and summed.
+  template <typename Vec>
+  long ShortVectors(const lasd::Vector<ulong>& sizes, ulong& buffers)
+  {
+    ulong before = Tracked::buffers;
+    long sum = 0;
+    for (ulong i = 0; i < sizes.Size(); ++i)
+    {
+      Vec vec(sizes[i]);
+      for (ulong j = 0; j < vec.Size(); ++j)
+        vec[j].key = i + j;
+      vec.Resize(vec.Size() + 2);
+      Vec copy(vec);
+      for (ulong j = 0; j < copy.Size(); ++j)
+        sum += copy[j].key;
+    }
+    buffers = Tracked::buffers - before;
+    return sum;
+  }
+
+  void SmallVectorBench()
+  {
+    std::cout << std::endl << "~*~ Small vector benchmark ~*~" << std::endl;
+    // Nine vectors in ten hold at most 12 elements, the others up to 64.
+    const ulong n = 2000000 * BENCH_SCALE;
+    std::mt19937 gen(BENCH_SEED);
+    lasd::Vector<ulong> sizes(n);
+    ulong spilling = 0;
+    for (ulong i = 0; i < n; ++i)
+    {
+      sizes[i] = (gen() % 10 != 0) ? gen() % 13 : 13 + gen() % 52;
+      spilling += (sizes[i] > 16) + 2 * (sizes[i] + 2 > 16);
+    }
+    std::cout << n << " short-lived vectors" << std::endl;
+    ulong vecBuffers = 0, smallBuffers = 0;
+    long vecSum = 0, smallSum = 0;
+    Report("Vector<Tracked>", n, Measure([&]() { vecSum = ShortVectors<lasd::Vector<Tracked>>(sizes, vecBuffers); }));
+    std::cout << "    heap buffers: " << vecBuffers << std::endl;
+    Report("SmallVector<Tracked, 16>", n, Measure([&]() { smallSum = ShortVectors<lasd::SmallVector<Tracked, 16>>(sizes, smallBuffers); }));
+    std::cout << "    heap buffers: " << smallBuffers << std::endl;
+    Check("Both sum the same", vecSum == smallSum);
+    Check("SmallVector allocates only past 16 elements", smallBuffers == spilling);
+
+    // Sets of up to ten keys, built and copied: SetVec starts at ten slots
+    const ulong sets = n / 10;
+    auto shortSets = [&sets](auto set, ulong& buffers) {
+      ulong before = Tracked::buffers;
+      long sum = 0;
+      for (ulong i = 0; i < sets; ++i)
+      {
+        decltype(set) fresh;
+        for (ulong j = 0; j <= i % 10; ++j)
+          fresh.Insert(Tracked{static_cast<long>(i * j)});
+        decltype(set) copy(fresh);
+        sum += copy.Max().key;
+      }
+      buffers = Tracked::buffers - before;
+      return sum;
+    };
+    ulong setBuffers = 0, smallSetBuffers = 0;
+    Report("SetVec<Tracked>", sets, Measure([&]() { vecSum = shortSets(lasd::SetVec<Tracked>(), setBuffers); }));
+    std::cout << "    heap buffers: " << setBuffers << std::endl;
+    Report("SetVec<Tracked, SmallVector<Tracked, 16>>", sets, Measure([&]() { smallSum = shortSets(lasd::SetVec<Tracked, lasd::SmallVector<Tracked, 16>>(), smallSetBuffers); }));
+    std::cout << "    heap buffers: " << smallSetBuffers << std::endl;
+    Check("Small sets on SmallVector storage stay off the heap", vecSum == smallSum && smallSetBuffers == 0);
+  }
+
+  /* ************************************************************************ */
+
+  // One short-lived queue per request: a few dozen jobs queued, then all
+  // handled in order.
+  template <typename Queue>
+  long Requests(ulong requests, ulong jobs, ulong& buffers)
+  {
+    std::mt19937_64 gen(BENCH_SEED);
+    ulong before = Tracked::buffers;
+    long sum = 0;
+    for (ulong r = 0; r < requests; ++r)
+    {
+      Queue pq;
+      for (ulong j = 0; j < jobs; ++j)
+        pq.Insert(Tracked{static_cast<long>(gen() >> 1)});
+      while (!pq.Empty())
+        sum = sum * 31 + pq.TipNRemove().key;
+    }
+    buffers = Tracked::buffers - before;
+    return sum;
+  }
+
+  void StaticBench()
+  {
+    std::cout << std::endl << "~*~ Static priority queue benchmark ~*~" << std::endl;
+    const ulong requests = 200000 * BENCH_SCALE, jobs = 48;
+    std::cout << requests << " requests, " << jobs << " jobs each" << std::endl;
+    ulong heapBuffers = 0, staticBuffers = 0;
+    long heapSum = 0, staticSum = 0;
+    Report("PQHeap<Tracked, 4>", requests * jobs, Measure([&]() { heapSum = Requests<lasd::PQHeap<Tracked, 4>>(requests, jobs, heapBuffers); }));
+    std::cout << "    heap buffers: " << heapBuffers << std::endl;
+    Report("PQStatic<Tracked, 64, 4>", requests * jobs, Measure([&]() { staticSum = Requests<lasd::PQStatic<Tracked, 64, 4>>(requests, jobs, staticBuffers); }));
+    std::cout << "    heap buffers: " << staticBuffers << std::endl;
+    Check("Both handle the same jobs", heapSum == staticSum);
+    Check("PQStatic never allocates", staticBuffers == 0);
+  }
+
+  /* ************************************************************************ */
+
+  // A lookup table of pseudo-random keys with repetitions, generated, sorted
+  // and deduplicated by the compiler.
+  const ulong tableSize = 4096;
+
+  constexpr ulong TableKey(ulong i)
+  {
+    return ((i * 6364136223846793005UL + 1442695040888963407UL) >> 33) % (tableSize * 4);
+  }
+
+  constexpr lasd::SetFrozen<ulong, tableSize> MakeTable()
+  {
+    ulong keys[tableSize]{};
+    for (ulong i = 0; i < tableSize; ++i)
+      keys[i] = TableKey(i % (tableSize - tableSize / 8));
+    return lasd::SetFrozen<ulong, tableSize>(keys);
+  }
+
+  constexpr lasd::SetFrozen<ulong, tableSize> frozenTable = MakeTable();
+
+  void FrozenBench()
+  {
+    std::cout << std::endl << "~*~ Compile-time table benchmark ~*~" << std::endl;
+    std::cout << tableSize << " generated keys, " << frozenTable.Size() << " distinct, sorted at compile time" << std::endl;
+
+    const ulong rounds = 100 * BENCH_SCALE, setRounds = 10 * BENCH_SCALE;
+    lasd::SortableVector<ulong> sorted;
+    Report("SortableVector fill + Sort at startup", rounds, Measure([&]() {
+      for (ulong r = 0; r < rounds; ++r)
+      {
+        lasd::SortableVector<ulong> vec(tableSize);
+        for (ulong i = 0; i < tableSize; ++i)
+          vec[i] = TableKey(i % (tableSize - tableSize / 8));
+        vec.Sort();
+        sorted = std::move(vec);
+      }
+    }));
+    lasd::SetVec<ulong> set;
+    Report("SetVec built from the keys at startup", setRounds, Measure([&]() {
+      for (ulong r = 0; r < setRounds; ++r)
+      {
+        lasd::SetVec<ulong> fresh;
+        for (ulong i = 0; i < tableSize; ++i)
+          fresh.Insert(TableKey(i % (tableSize - tableSize / 8)));
+        set = std::move(fresh);
+      }
+    }));
+
+    bool same = set.Size() == frozenTable.Size();
+    for (ulong i = 0, j = 0; same && i < sorted.Size(); ++i)
+      if (i == 0 || sorted[i] != sorted[i - 1])
+      {
+        same = sorted[i] == frozenTable[j] && set.Select(j) == frozenTable[j];
+        ++j;
+      }
+    Check("The frozen table matches the sorted keys and SetVec", same);
+
+    const ulong lookups = 2000000 * BENCH_SCALE;
+    ulong setHits = 0, frozenHits = 0;
+    Report("SetVec::Exists", lookups, Measure([&]() {
+      for (ulong i = 0; i < lookups; ++i)
+        setHits += set.Exists(i % (tableSize * 4));
+    }));
+    Report("SetFrozen::Exists", lookups, Measure([&]() {
+      for (ulong i = 0; i < lookups; ++i)
+        frozenHits += frozenTable.Exists(i % (tableSize * 4));
+    }));
+    Check("Both find the same keys", setHits == frozenHits);
+  }
+
+  /* ************************************************************************ */
+
+  // One request: a few dozen entries gathered in a list, deduplicated in a set
+  // and scheduled in a priority queue, all dropped when it is served.
+  template <typename Make>
+  long Request(std::mt19937_64& gen, ulong entries, Make make)
+  {
+    auto list = make.template operator()<lasd::List<std::string>>();
+    auto setLst = make.template operator()<lasd::SetLst<long>>();
+    auto heap = make.template operator()<lasd::PQHeap<long, 4>>();
+    for (ulong j = 0; j < entries; ++j)
+    {
+      long key = static_cast<long>(gen() % 256);
+      list.InsertAtBack(std::to_string(key));
+      setLst.Insert(key);
+      heap.Insert(key);
+    }
+    long sum = static_cast<long>(list.Size()) + setLst.Max();
+    while (!heap.Empty())
+      sum = sum * 31 + heap.TipNRemove();
+    return sum;
+  }
+
+  void ArenaBench()
+  {
+    std::cout << std::endl << "~*~ Memory resource benchmark ~*~" << std::endl;
+    const ulong requests = 100000 * BENCH_SCALE, entries = 48;
+    std::cout << requests << " requests, " << entries << " entries each" << std::endl;
+    long freeSum = 0, arenaSum = 0;
+    Report("Free store", requests, Measure([&]() {
+      std::mt19937_64 gen(BENCH_SEED);
+      for (ulong r = 0; r < requests; ++r)
+        freeSum += Request(gen, entries, []<typename Box>() { return Box(); });
+    }));
+    Report("Monotonic arena per request", requests, Measure([&]() {
+      std::mt19937_64 gen(BENCH_SEED);
+      alignas(std::max_align_t) static std::byte storage[1 << 16];
+      for (ulong r = 0; r < requests; ++r)
+      {
+        std::pmr::monotonic_buffer_resource arena(storage, sizeof(storage));
+        arenaSum += Request(gen, entries, [&arena]<typename Box>() { return Box(arena); });
+      }
+    }));
+    Check("Both serve the same requests", freeSum == arenaSum);
+  }
+
+  /* ************************************************************************ */
+
+  // Huge pages currently backing this process, as reported by the kernel.
+  ulong AnonHugeKB()
+  {
+    std::ifstream smaps("/proc/self/smaps_rollup");
+    std::string field;
+    ulong kb = 0;
+    while (smaps >> field)
+      if (field == "AnonHugePages:")
+      {
+        smaps >> kb;
+        break;
+      }
+    return kb;
+  }
+
+  // Sequential passes, then independent random reads, over a large buffer.
+  // The scan keeps one partial sum per lane of a cache line, so that it is
+  // bound by memory rather than by a chain of additions.
+  double ScanSum(const lasd::Vector<float>& vec, ulong passes)
+  {
+    const ulong lanes = lasd::AlignedResource::cacheLine / sizeof(float);
+    const float* buf = &vec[0];
+    ulong dim = vec.Size() / lanes * lanes;
+    double sum = 0;
+    for (ulong p = 0; p < passes; ++p)
+    {
+      float part[lanes]{};
+      for (ulong i = 0; i < dim; i += lanes)
+        for (ulong l = 0; l < lanes; ++l)
+          part[l] += buf[i + l];
+      for (ulong l = 0; l < lanes; ++l)
+        sum += part[l];
+      for (ulong i = dim; i < vec.Size(); ++i)
+        sum += buf[i];
+    }
+    return sum;
+  }
+
+  double RandomSum(const lasd::Vector<float>& vec, ulong reads)
+  {
+    const float* buf = &vec[0];
+    ulong state = BENCH_SEED, dim = vec.Size();
+    double sum = 0;
+    for (ulong r = 0; r < reads; ++r)
+    {
+      state = state * 6364136223846793005UL + 1442695040888963407UL;
+      sum += buf[(state >> 20) % dim];
+    }
+    return sum;
+  }
+
+  void AlignedBench()
+  {
+    std::cout << std::endl << "~*~ Aligned and huge page buffers benchmark ~*~" << std::endl;
+    const ulong dim = 32 * 1024 * 1024 * BENCH_SCALE, passes = 4, reads = 16 * 1024 * 1024;
+    std::cout << dim << " floats (" << dim * sizeof(float) / (1024 * 1024) << " MB), "
+              << passes << " scans, " << reads << " random reads" << std::endl;
+    lasd::AlignedResource lines, huge(lasd::AlignedResource::cacheLine, lasd::AlignedResource::hugePage);
+    const char* names[] = {"new[]", "AlignedResource", "AlignedResource + huge pages"};
+    double scans[3], randoms[3];
+    for (int kind = 0; kind < 3; ++kind)
+    {
+      ulong hugeBefore = AnonHugeKB();
+      lasd::Vector<float> vec = (kind == 0) ? lasd::Vector<float>(dim) : lasd::Vector<float>(dim, (kind == 1) ? lines : huge);
+      for (ulong i = 0; i < dim; ++i)
+        vec[i] = static_cast<float>(i % 1000);
+      std::cout << "  " << names[kind] << ": buffer at offset " << reinterpret_cast<std::uintptr_t>(&vec[0]) % 4096
+                << " in its page, " << (AnonHugeKB() - std::min(AnonHugeKB(), hugeBefore)) / 1024 << " MB on huge pages" << std::endl;
+      Report(std::string(names[kind]) + " sequential scan", passes * dim, Measure([&]() { scans[kind] = ScanSum(vec, passes); }));
+      Report(std::string(names[kind]) + " random access", reads, Measure([&]() { randoms[kind] = RandomSum(vec, reads); }));
+    }
+    Check("All buffers read the same values", scans[0] == scans[1] && scans[1] == scans[2] && randoms[0] == randoms[1] && randoms[1] == randoms[2]);
+  }
+
+  /* ************************************************************************ */
+
+  struct Record
+  {
+    long id = 0;
+    double value = 0;
+    bool operator==(const Record&) const noexcept = default;
+  };
+
+  const ulong recordTag = 0x5245434f5244; // Tags files of Record
+
+  std::filesystem::path TempFile(const std::string& name)
+  {
+    return std::filesystem::temp_directory_path() / ("lasd-mapped-" + std::to_string(::getpid()) + "-" + name);
+  }
+
+  double Lookups(const lasd::LinearContainer<Record>& vec, ulong reads)
+  {
+    ulong state = BENCH_SEED;
+    double sum = 0;
+    for (ulong r = 0; r < reads; ++r)
+    {
+      state = state * 6364136223846793005UL + 1442695040888963407UL;
+      sum += vec[(state >> 20) % vec.Size()].value;
+    }
+    return sum;
+  }
+
+  void MappedBench()
+  {
+    std::cout << std::endl << "~*~ Memory-mapped vector benchmark ~*~" << std::endl;
+
+    const ulong n = 8 * 1024 * 1024 * BENCH_SCALE, reads = 100000;
+    std::filesystem::path file = TempFile("snapshot.vec");
+    std::cout << n << " records (" << n * sizeof(Record) / (1024 * 1024) << " MB) in a snapshot file, then "
+              << reads << " random lookups" << std::endl;
+    Report("Writing the snapshot through MappedVector", n, Measure([&]() {
+      lasd::MappedVector<Record> vec(file, lasd::MapMode::ReadWrite, recordTag);
+      vec.Resize(n);
+      Record* buf = &vec[0];
+      for (ulong i = 0; i < n; ++i)
+        buf[i] = Record{static_cast<long>(i), static_cast<double>(i % 1000)};
+    }));
+
+    double loadSum = 0, mapSum = 0;
+    lasd::Vector<Record> loaded;
+    Report("Reloading it into a Vector", n, Measure([&]() {
+      std::FILE* in = std::fopen(file.c_str(), "rb");
+      loaded.Resize(n);
+      std::fseek(in, 64, SEEK_SET);
+      if (std::fread(&loaded[0], sizeof(Record), n, in) != n)
+        loaded.Clear();
+      std::fclose(in);
+    }));
+    Report("  then the lookups", reads, Measure([&]() { loadSum = Lookups(loaded, reads); }));
+    lasd::MappedVector<Record> mapped(file, lasd::MapMode::ReadOnly, recordTag);
+    Report("Opening it as a MappedVector", 1, Measure([&]() { lasd::MappedVector<Record> vec(file, lasd::MapMode::ReadOnly, recordTag); }));
+    Report("  then the lookups", reads, Measure([&]() { mapSum = Lookups(mapped, reads); }));
+    Check("Both read the same snapshot", loadSum == mapSum && mapped.Size() == n);
+    std::filesystem::remove(file);
+  }
+
+} // namespace myB
+
+using namespace myB;
+
+void mybench()
+{
+  std::cout << std::endl << "~*~#~*~ Welcome to the LASD Benchmark Suite ~*~#~*~ " << std::endl;
+
+  RankSelectBench();
+  ChurnBench();
+  TieredBench();
+  TryBench();
+  ArityBench();
+  HoleBench();
+  BottomUpBench();
+  ComparatorBench();
+  AddressableBench();
+  PairingBench();
+  MinMaxBench();
+  RadixBench();
+  BatchBench();
+  MultiBench();
+  TopKBench();
+  PopKBench();
+  StableBench();
+  ExtBench();
+  WheelBench();
+  SmallVectorBench();
+  StaticBench();
+  FrozenBench();
+  ArenaBench();
+  AlignedBench();
+  MappedBench();
+
+  std::cout << std::endl << "Benchmark checks (Errors/Checks: " << bencherr << "/" << benchnum << ")" << std::endl;
+  std::cout << std::endl << "Goodbye!" << std::endl;
+}
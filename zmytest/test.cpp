@@ -3,6 +3,17 @@
 #include <random>
 #include <time.h>
 #include <typeinfo>
+#include <string>
+#include <thread>
+#include <array>
+#include <optional>
+#include <filesystem>
+#include <memory_resource>
+#include <csignal>
+#include <fstream>
+
+#include <sys/resource.h>
+#include <unistd.h>
 
 /* ************************************************************************** */
 
@@ -11,11 +22,27 @@
 #include "../container/mappable.hpp"
 #include "../container/linear.hpp"
 #include "../vector/vector.hpp"
+#include "../vector/small/smallvector.hpp"
+#include "../vector/static/staticvector.hpp"
+#include "../vector/aligned/alignedresource.hpp"
+#include "../vector/mapped/mappedvector.hpp"
 #include "../set/vec/setvec.hpp"
 #include "../list/list.hpp"
 #include "../set/lst/setlst.hpp"
+#include "../set/tvec/settvec.hpp"
+#include "../set/frozen/setfrozen.hpp"
 #include "../heap/vec/heapvec.hpp"      // <-- HeapVec
 #include "../pq/heap/pqheap.hpp"        // <-- PQHeap
+#include "../pq/addr/pqaddr.hpp"
+#include "../pq/pairing/pqpairing.hpp"
+#include "../pq/minmax/pqminmax.hpp"
+#include "../pq/radix/pqradix.hpp"
+#include "../pq/multi/pqmulti.hpp"
+#include "../pq/topk/pqtopk.hpp"
+#include "../pq/stable/pqstable.hpp"
+#include "../pq/ext/pqext.hpp"
+#include "../pq/wheel/pqwheel.hpp"
+#include "../pq/static/pqstatic.hpp"
 
 /* ************************************************************************** */
 
@@ -3636,6 +3663,1343 @@ namespace myT
     }
   }
 
+  /* ************************************************************************ */
+
+  // Behaviour tests of the containers beyond the exercises, counted as in
+  // zlasdtest: every check is one test, and each group reports its tally.
+
+  #define MYTEST_SEED 42
+
+  void Check(uint & testnum, uint & testerr, const std::string & name, bool tst) {
+    testnum++;
+    std::cout << " " << testnum << " (" << testerr << ") " << name << ": " << (tst ? "Correct" : "Error") << "!" << std::endl;
+    testerr += (1 - (uint) tst);
+  }
+
+  // Whether the function throws an exception of the given type.
+  template <typename Exc, typename Fun>
+  bool Throws(Fun fun) {
+    try { fun(); }
+    catch (const Exc &) { return true; }
+    catch (...) { return false; }
+    return false;
+  }
+
+  template <typename Test>
+  void Group(uint & testnum, uint & testerr, const std::string & name, Test test) {
+    uint loctestnum = 0, loctesterr = 0;
+    std::cout << std::endl << "Begin of " << name << " Test:" << std::endl;
+    try {
+      test(loctestnum, loctesterr);
+    }
+    catch (...) {
+      loctestnum++; loctesterr++;
+      std::cout << std::endl << "Unmanaged error! " << std::endl;
+    }
+    std::cout << "End of " << name << " Test! (Errors/Tests: " << loctesterr << "/" << loctestnum << ")" << std::endl;
+    testnum += loctestnum;
+    testerr += loctesterr;
+  }
+
+  lasd::Vector<long> RandomKeys(ulong n, ulong seed = MYTEST_SEED) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<long> dist(0, 1L << 40);
+    lasd::Vector<long> keys(n);
+    keys.Map([&gen, &dist](long & dat) { dat = dist(gen); });
+    return keys;
+  }
+
+  template <typename Linear>
+  bool IsSorted(const Linear & box) {
+    bool sorted = true;
+    for (ulong i = 1; sorted && i < box.Size(); ++i)
+      sorted = !(box[i - 1] > box[i]);
+    return sorted;
+  }
+
+  /* ************************************************************************ */
+
+  template <typename Set>
+  void testRankSelect(uint & testnum, uint & testerr) {
+    Set box;
+    lasd::Set<long> & set = box;
+    Check(testnum, testerr, "Rank on an empty set is 0", set.Rank(5) == 0);
+    Check(testnum, testerr, "Select on an empty set throws std::out_of_range", Throws<std::out_of_range>([&set]() { set.Select(0); }));
+
+    lasd::Vector<long> keys = RandomKeys(300);
+    for (ulong i = 0; i < keys.Size(); ++i)
+      set.Insert(keys[i] % 1000);
+    bool agree = true;
+    for (ulong k = 0; agree && k < set.Size(); ++k)
+      agree = (set.Select(k) == set[k]) && (set.Rank(set.Select(k)) == k);
+    Check(testnum, testerr, "Select(k) is the k-th key and Rank(Select(k)) == k", agree);
+
+    bool missing = true;
+    for (long key = -1; missing && key <= 1001; key += 7) {
+      ulong less = set.template Fold<ulong>([key](const long & dat, const ulong & acc) { return (dat < key) ? acc + 1 : acc; }, 0);
+      missing = (set.Rank(key) == less);
+    }
+    Check(testnum, testerr, "Rank counts the keys strictly less, present or not", missing);
+    Check(testnum, testerr, "Rank past the maximum is the size", set.Rank(set.Max() + 1) == set.Size() && set.Rank(set.Min()) == 0);
+    Check(testnum, testerr, "Select past the end throws std::out_of_range", Throws<std::out_of_range>([&set]() { set.Select(set.Size()); }));
+  }
+
+  template <typename Set>
+  void testTryLookups(uint & testnum, uint & testerr) {
+    Set box;
+    lasd::Set<long> & set = box;
+    Check(testnum, testerr, "Try lookups on an empty set give nullptr",
+      set.TryMin() == nullptr && set.TryMax() == nullptr && set.TryPredecessor(5) == nullptr && set.TrySuccessor(5) == nullptr);
+    Check(testnum, testerr, "Min on an empty set throws std::length_error", Throws<std::length_error>([&set]() { set.Min(); }));
+
+    set.Insert(10);
+    set.Insert(20);
+    set.Insert(30);
+    Check(testnum, testerr, "TryMin/TryMax", *set.TryMin() == 10 && *set.TryMax() == 30);
+    Check(testnum, testerr, "TryPredecessor misses at the minimum", set.TryPredecessor(10) == nullptr && *set.TryPredecessor(11) == 10);
+    Check(testnum, testerr, "TrySuccessor misses at the maximum", set.TrySuccessor(30) == nullptr && *set.TrySuccessor(20) == 30);
+
+    bool agree = true;
+    for (long key = 0; agree && key < 40; ++key) {
+      const long * pred = set.TryPredecessor(key);
+      const long * succ = set.TrySuccessor(key);
+      bool predThrows = Throws<std::length_error>([&set, key]() { set.Predecessor(key); });
+      bool succThrows = Throws<std::length_error>([&set, key]() { set.Successor(key); });
+      agree = (pred == nullptr) == predThrows && (succ == nullptr) == succThrows
+        && (pred == nullptr || *pred == set.Predecessor(key)) && (succ == nullptr || *succ == set.Successor(key));
+    }
+    Check(testnum, testerr, "Try lookups agree with the throwing ones", agree);
+  }
+
+  void testTryTip(uint & testnum, uint & testerr) {
+    lasd::PQHeap<long> pq;
+    Check(testnum, testerr, "TryTip on an empty queue gives nullptr", pq.TryTip() == nullptr && !pq.TryTipNRemove().has_value());
+    Check(testnum, testerr, "TipNRemove on an empty queue throws std::length_error", Throws<std::length_error>([&pq]() { pq.TipNRemove(); }));
+    pq.Insert(3);
+    pq.Insert(7);
+    Check(testnum, testerr, "TryTip on a non-empty queue", pq.TryTip() != nullptr && *pq.TryTip() == 7);
+    Check(testnum, testerr, "TryTipNRemove drains in order", *pq.TryTipNRemove() == 7 && *pq.TryTipNRemove() == 3 && !pq.TryTipNRemove());
+  }
+
+  /* ************************************************************************ */
+
+  // Random operations applied to SetVec and SetTVec, checking every answer.
+  bool TieredMatchesFlat(ulong ops) {
+    std::mt19937 gen(MYTEST_SEED);
+    std::uniform_int_distribution<long> dist(0, 3000);
+    lasd::SetVec<long> flat;
+    lasd::SetTVec<long> tiered;
+    bool same = true;
+    for (ulong i = 0; same && i < ops; ++i) {
+      long key = dist(gen);
+      switch (gen() % 6) {
+        case 0: case 1: case 2:
+          same = (flat.Insert(key) == tiered.Insert(key));
+          break;
+        case 3:
+          same = (flat.Remove(key) == tiered.Remove(key));
+          break;
+        case 4:
+          same = (flat.Rank(key) == tiered.Rank(key));
+          if (same && flat.Rank(key) > 0)
+            same = (flat.PredecessorNRemove(key) == tiered.PredecessorNRemove(key));
+          break;
+        default:
+          if (!flat.Empty() && key < flat.Max())
+            same = (flat.SuccessorNRemove(key) == tiered.SuccessorNRemove(key));
+          if (same && !flat.Empty())
+            same = (flat.MinNRemove() == tiered.MinNRemove());
+          if (same && !flat.Empty())
+            same = (flat.Max() == tiered.Max());
+      }
+    }
+    const lasd::LinearContainer<long> & sx = flat;
+    const lasd::LinearContainer<long> & dx = tiered;
+    return same && sx == dx;
+  }
+
+  void testSetTVec(uint & testnum, uint & testerr) {
+    lasd::SetTVec<long> set;
+    Check(testnum, testerr, "Min/Max on an empty set throw std::length_error",
+      Throws<std::length_error>([&set]() { set.Min(); }) && Throws<std::length_error>([&set]() { set.MaxNRemove(); }));
+    Check(testnum, testerr, "operator[] on an empty set throws std::out_of_range", Throws<std::out_of_range>([&set]() { set[0]; }));
+    Check(testnum, testerr, "SetTVec matches SetVec on random operations", TieredMatchesFlat(20000));
+
+    for (long key = 0; key < 500; ++key)
+      set.Insert((key * 37) % 500);
+    Check(testnum, testerr, "Keys come out sorted across tiers", set.Size() == 500 && IsSorted(set) && set[499] == 499);
+    Check(testnum, testerr, "Predecessor of the minimum throws std::length_error", Throws<std::length_error>([&set]() { set.Predecessor(0); }));
+    Check(testnum, testerr, "Successor of the maximum throws std::length_error", Throws<std::length_error>([&set]() { set.RemoveSuccessor(499); }));
+
+    lasd::SetTVec<long> copy(set);
+    Check(testnum, testerr, "Copy constructor", copy == set);
+    copy.Remove(250);
+    Check(testnum, testerr, "The copy is independent", copy != set && set.Exists(250));
+    lasd::SetTVec<long> moved(std::move(copy));
+    Check(testnum, testerr, "Move constructor", moved.Size() == 499 && !moved.Exists(250) && copy.Empty());
+    copy = moved;
+    moved = std::move(set);
+    Check(testnum, testerr, "Copy and move assignment", copy.Size() == 499 && moved.Size() == 500 && moved.Exists(250));
+    moved.Clear();
+    Check(testnum, testerr, "Clear", moved.Empty() && moved.TryMin() == nullptr && moved.Insert(1) && moved.Size() == 1);
+  }
+
+  /* ************************************************************************ */
+
+  // Stateful comparator: vertices ordered by a distance table, nearest first.
+  struct NearerFirst {
+    const lasd::Vector<long> * dist = nullptr;
+    bool operator()(ulong a, ulong b) const { return (*dist)[a] > (*dist)[b]; }
+  };
+
+  template <ulong Arity>
+  void HeapArity(uint & testnum, uint & testerr, const lasd::Vector<long> & keys) {
+    std::string name = std::to_string(Arity) + "-ary ";
+    lasd::PQHeap<long, Arity> pq(keys);
+    bool ordered = true;
+    long last = pq.Tip();
+    while (ordered && !pq.Empty()) {
+      long cur = pq.TipNRemove();
+      ordered = !(cur > last);
+      last = cur;
+    }
+    Check(testnum, testerr, name + "PQHeap pops in non-increasing order", ordered && pq.Empty());
+    lasd::HeapVec<long, Arity> heap(keys);
+    Check(testnum, testerr, name + "HeapVec is a heap", heap.IsHeap());
+    lasd::HeapVec<long, Arity> topDown(heap);
+    heap.Sort();
+    topDown.TopDownSort();
+    const lasd::LinearContainer<long> & sx = heap;
+    const lasd::LinearContainer<long> & dx = topDown;
+    Check(testnum, testerr, name + "bottom-up and top-down heapsort sort", IsSorted(heap) && sx == dx);
+  }
+
+  // Batches interleaved with single inserts, changes and pops, against a
+  // sorted copy of everything inserted.
+  bool BatchesMatchSorted(ulong n) {
+    lasd::Vector<long> keys = RandomKeys(n);
+    lasd::PQHeap<long> pq;
+    ulong at = 0;
+    for (ulong batch = 1; at + batch <= n / 2; batch *= 3) {
+      lasd::Vector<long> part(batch);
+      for (ulong i = 0; i < batch; ++i)
+        part[i] = keys[at++];
+      if (batch % 2 == 1)
+        pq.InsertAll(std::move(part));
+      else
+        pq.InsertAll(part);
+      pq.Insert(keys[at++]);
+    }
+    pq.Change(pq.Size() - 1, keys[at++]);
+    bool same = (pq.Tip() == pq.TipNRemove());
+    while (at < n)
+      pq.Insert(keys[at++]);
+    const lasd::TraversableContainer<long> & view = pq;
+    lasd::SortableVector<long> contents(view);
+    contents.Sort(std::greater<long>());
+    lasd::PQHeap<long> copy(pq);
+    for (ulong i = 0; same && i < contents.Size(); ++i)
+      same = (pq.TipNRemove() == contents[i]) && (copy.TipNRemove() == contents[i]);
+    return same && pq.Empty();
+  }
+
+  void testPQHeap(uint & testnum, uint & testerr) {
+    lasd::Vector<long> keys = RandomKeys(2000);
+    HeapArity<2>(testnum, testerr, keys);
+    HeapArity<4>(testnum, testerr, keys);
+    HeapArity<8>(testnum, testerr, keys);
+
+    lasd::PQHeap<std::string> changed;
+    for (char c = 'b'; c <= 'y'; ++c)
+      changed.Insert(std::string(8, c));
+    changed.Change(changed.Size() - 1, std::string(8, 'z'));
+    bool raised = (changed.Tip() == std::string(8, 'z'));
+    changed.Change(0, std::string(8, 'a'));
+    std::string least;
+    while (!changed.Empty())
+      least = changed.TipNRemove();
+    Check(testnum, testerr, "Change by move sifts both ways", raised && least == std::string(8, 'a'));
+
+    lasd::PQHeap<long, 2, std::greater<long>> minPQ(keys);
+    bool ascending = true;
+    long prev = minPQ.Tip();
+    while (ascending && !minPQ.Empty()) {
+      long cur = minPQ.TipNRemove();
+      ascending = prev <= cur;
+      prev = cur;
+    }
+    Check(testnum, testerr, "std::greater pops in ascending order", ascending);
+    Check(testnum, testerr, "Stateless comparator takes no space", sizeof(lasd::PQHeap<long, 2, std::greater<long>>) == sizeof(lasd::PQHeap<long>));
+
+    lasd::Vector<long> dist = RandomKeys(500);
+    lasd::Vector<ulong> vertices(500);
+    for (ulong i = 0; i < vertices.Size(); ++i)
+      vertices[i] = i;
+    lasd::PQHeap<ulong, 4, NearerFirst> byDist(vertices, NearerFirst{&dist});
+    bool nearest = true;
+    prev = dist[byDist.Tip()];
+    while (nearest && !byDist.Empty()) {
+      long cur = dist[byDist.TipNRemove()];
+      nearest = prev <= cur;
+      prev = cur;
+    }
+    Check(testnum, testerr, "Stateful comparator orders by distance", nearest);
+
+    lasd::SortableVector<long, std::greater<long>> desc(keys);
+    desc.Sort();
+    lasd::SortableVector<long> asc(keys);
+    lasd::SortableLinearContainer<long> & lin = asc;
+    lin.Sort(std::greater<long>());
+    bool descending = true;
+    for (ulong i = 1; i < keys.Size(); ++i)
+      descending = descending && !(desc[i - 1] < desc[i]) && !(asc[i - 1] < asc[i]);
+    Check(testnum, testerr, "Comparator sorts give descending order", descending);
+
+    lasd::SortableVector<long> sorted(keys);
+    sorted.Sort(std::greater<long>());
+    bool popK = true;
+    for (ulong k : {0UL, 1UL, 10UL, 700UL, keys.Size()}) {
+      lasd::PQHeap<long> pq(keys);
+      lasd::Vector<long> top = pq.TipNRemove(k);
+      popK = popK && top.Size() == k && pq.Size() == keys.Size() - k;
+      for (ulong i = 0; popK && i < k; ++i)
+        popK = (top[i] == sorted[i]);
+      for (ulong i = k; popK && i < keys.Size(); ++i)
+        popK = (pq.TipNRemove() == sorted[i]);
+    }
+    Check(testnum, testerr, "TipNRemove(k) matches a sorted copy", popK);
+    lasd::PQHeap<long> few(keys);
+    Check(testnum, testerr, "TipNRemove(k) beyond the size throws std::length_error and removes nothing",
+      Throws<std::length_error>([&few, &keys]() { few.TipNRemove(keys.Size() + 1); }) && few.Size() == keys.Size());
+
+    Check(testnum, testerr, "Batches interleaved with single operations pop in order", BatchesMatchSorted(5000));
+
+    lasd::PQHeap<long> lazy(keys);
+    lazy.InsertAll(RandomKeys(100, MYTEST_SEED + 3));
+    const lasd::LinearContainer<long> & layout = lazy;
+    long pendingFirst = layout[keys.Size()];
+    long tip = lazy.Tip();
+    Check(testnum, testerr, "Reading the tip leaves a pending batch in place", *lazy.TryTip() == tip && layout[keys.Size()] == pendingFirst);
+    lazy.Flush();
+    Check(testnum, testerr, "Flush merges the batch under the tip", layout[0] == tip && lazy.Tip() == tip && lazy.Size() == keys.Size() + 100);
+  }
+
+  /* ************************************************************************ */
+
+  // Handles must keep naming their elements across every heap operation.
+  bool HandlesTrackElements(ulong n) {
+    lasd::Vector<long> keys = RandomKeys(n);
+    lasd::PQAddr<long> pq;
+    lasd::Vector<lasd::PQAddr<long>::Handle> handle(n);
+    for (ulong i = 0; i < n; ++i)
+      handle[i] = pq.Push(keys[i]);
+    lasd::PQAddr<long> built(keys);
+    bool same = (built == pq);
+    for (ulong i = 0; i < n; i += 3) {
+      pq.Change(handle[i], keys[i] ^ 0x5555);
+      keys[i] ^= 0x5555;
+    }
+    for (ulong i = 1; i < n; i += 3)
+      same = same && (pq.Extract(handle[i]) == keys[i]);
+    for (ulong i = 0; i < n; ++i)
+      same = same && (pq.Contains(handle[i]) == (i % 3 != 1)) && (i % 3 == 1 || pq[handle[i]] == keys[i]);
+    lasd::SortableVector<long> rest(n - (n + 1) / 3);
+    for (ulong i = 0, j = 0; i < n; ++i)
+      if (i % 3 != 1)
+        rest[j++] = keys[i];
+    rest.Sort(std::greater<long>());
+    for (ulong j = 0; same && j < rest.Size(); ++j)
+      same = (pq.TipNRemove() == rest[j]);
+    return same && pq.Empty();
+  }
+
+  void testPQAddr(uint & testnum, uint & testerr) {
+    lasd::PQAddr<long> pq;
+    Check(testnum, testerr, "Tip and TipHandle on an empty queue throw std::length_error",
+      Throws<std::length_error>([&pq]() { pq.Tip(); }) && Throws<std::length_error>([&pq]() { pq.TipHandle(); }));
+    Check(testnum, testerr, "operator[] on an empty queue throws std::out_of_range", Throws<std::out_of_range>([&pq]() { pq[0UL]; }));
+    Check(testnum, testerr, "Handles track their elements", HandlesTrackElements(3000));
+
+    lasd::PQAddr<long>::Handle gone = pq.Push(10);
+    pq.Push(5);
+    Check(testnum, testerr, "TipHandle names the tip", pq.TipHandle() == gone);
+    pq.RemoveTip();
+    lasd::PQAddr<long>::Handle fresh = pq.Push(7);
+    Check(testnum, testerr, "A reused slot gets a new generation", gone.slot == fresh.slot && !(gone == fresh) && !pq.Contains(gone) && pq[fresh] == 7);
+    Check(testnum, testerr, "A stale handle throws std::out_of_range",
+      Throws<std::out_of_range>([&]() { pq.Remove(gone); }) && Throws<std::out_of_range>([&]() { pq.Change(gone, 1L); })
+      && Throws<std::out_of_range>([&]() { pq.Extract(gone); }) && Throws<std::out_of_range>([&]() { pq[gone]; }));
+
+    lasd::PQAddr<long> copy(pq);
+    Check(testnum, testerr, "A copy answers to the same handles", copy == pq && copy.Contains(fresh) && copy[fresh] == 7);
+    copy.Change(fresh, 70L);
+    Check(testnum, testerr, "The copy is independent", copy[fresh] == 70 && pq[fresh] == 7);
+    lasd::PQAddr<long> moved(std::move(copy));
+    Check(testnum, testerr, "Handles follow a move", moved.Contains(fresh) && moved[fresh] == 70 && copy.Empty() && !copy.Contains(fresh));
+
+    pq.Clear();
+    lasd::PQAddr<long>::Handle later = pq.Push(3);
+    Check(testnum, testerr, "Clear invalidates every handle", !pq.Contains(fresh) && pq.Contains(later) && pq.Size() == 1);
+  }
+
+  /* ************************************************************************ */
+
+  bool MeldKeepsEverything(ulong n) {
+    lasd::Vector<long> a = RandomKeys(n, MYTEST_SEED + 1), b = RandomKeys(n, MYTEST_SEED + 2);
+    lasd::PQPairing<long> left(a), right(b);
+    lasd::PQPairing<long>::Handle kept = right.Push(-1);
+    left.Meld(std::move(right));
+    bool same = right.Empty() && left.Size() == 2 * n + 1 && left.Contains(kept);
+    left.Change(kept, 1L << 50);
+    same = same && left.Tip() == (1L << 50);
+    left.RemoveTip();
+    same = same && !left.Contains(kept);
+    lasd::SortableVector<long> all(2 * n);
+    for (ulong i = 0; i < n; ++i) {
+      all[i] = a[i];
+      all[n + i] = b[i];
+    }
+    all.Sort(std::greater<long>());
+    for (ulong i = 0; same && i < 2 * n; ++i)
+      same = (left.TipNRemove() == all[i]);
+    return same && left.Empty();
+  }
+
+  void testPQPairing(uint & testnum, uint & testerr) {
+    lasd::PQPairing<long> pq;
+    Check(testnum, testerr, "Tip and TipHandle on an empty queue throw std::length_error",
+      Throws<std::length_error>([&pq]() { pq.Tip(); }) && Throws<std::length_error>([&pq]() { pq.TipHandle(); }));
+    Check(testnum, testerr, "RemoveTip on an empty queue throws std::length_error", Throws<std::length_error>([&pq]() { pq.RemoveTip(); }));
+    Check(testnum, testerr, "operator[] on an empty queue throws std::out_of_range", Throws<std::out_of_range>([&pq]() { pq[0UL]; }));
+    Check(testnum, testerr, "Meld keeps every element and handle", MeldKeepsEverything(1000));
+
+    lasd::PQPairing<long>::Handle stale = pq.Push(7);
+    pq.Remove(stale);
+    lasd::PQPairing<long>::Handle fresh = pq.Push(9);
+    Check(testnum, testerr, "A reused node gets a new generation", fresh.node == stale.node && !pq.Contains(stale) && pq.Contains(fresh));
+    Check(testnum, testerr, "A stale handle throws std::out_of_range",
+      Throws<std::out_of_range>([&]() { pq.Remove(stale); }) && Throws<std::out_of_range>([&]() { pq.Change(stale, 1L); })
+      && Throws<std::out_of_range>([&]() { pq[stale]; }));
+
+    for (long key = 0; key < 50; ++key)
+      pq.Push(key);
+    lasd::PQPairing<long> copy(pq);
+    Check(testnum, testerr, "Copy constructor", copy == pq && copy.Size() == 51);
+    copy.RemoveTip();
+    Check(testnum, testerr, "The copy is independent", copy != pq && pq.Tip() == 49 && pq.Contains(fresh));
+    lasd::PQPairing<long> moved(std::move(pq));
+    Check(testnum, testerr, "Handles follow a move", moved.Contains(fresh) && moved[fresh] == 9 && pq.Empty() && moved.Size() == 51);
+    moved.Change(fresh, 100L);
+    Check(testnum, testerr, "Change by handle", moved.Tip() == 100 && moved.TipNRemove() == 100 && !moved.Contains(fresh));
+
+    lasd::PQPairing<long>::Handle cleared = moved.TipHandle();
+    moved.Clear();
+    Check(testnum, testerr, "Clear invalidates every handle", moved.Empty() && !moved.Contains(cleared));
+    Check(testnum, testerr, "A handle taken before Clear throws std::out_of_range",
+      Throws<std::out_of_range>([&]() { moved.Change(cleared, 1L); }) && Throws<std::out_of_range>([&]() { moved[cleared]; }));
+    lasd::PQPairing<long>::Handle reused = moved.Push(5);
+    Check(testnum, testerr, "A node reused after Clear does not match the old handle", !moved.Contains(cleared) && moved.Contains(reused));
+    moved = copy;
+    Check(testnum, testerr, "Copy assignment invalidates every handle",
+      moved == copy && !moved.Contains(reused) && Throws<std::out_of_range>([&]() { moved.Remove(reused); }));
+  }
+
+  /* ************************************************************************ */
+
+  // Random Change calls checked against a sorted copy of the contents.
+  bool MinMaxMatchesSorted(ulong n) {
+    lasd::Vector<long> keys = RandomKeys(n);
+    lasd::PQMinMax<long> pq(keys);
+    bool same = pq.IsHeap();
+    std::mt19937 gen(MYTEST_SEED);
+    std::uniform_int_distribution<ulong> at(0, n - 1);
+    lasd::Vector<long> vals = RandomKeys(n, MYTEST_SEED + 1);
+    for (ulong i = 0; i < n; ++i)
+      pq.Change(at(gen), vals[i]);
+    same = same && pq.IsHeap();
+    const lasd::TraversableContainer<long> & view = pq;
+    lasd::SortableVector<long> contents(view);
+    contents.Sort();
+    ulong lo = 0, hi = n;
+    for (ulong i = 0; same && i < n; ++i)
+      same = (i % 2 == 0) ? (pq.MinNRemove() == contents[lo++]) : (pq.MaxNRemove() == contents[--hi]);
+    return same && pq.Empty();
+  }
+
+  void testPQMinMax(uint & testnum, uint & testerr) {
+    lasd::PQMinMax<long> pq;
+    Check(testnum, testerr, "Min/Max on an empty queue throw std::length_error",
+      Throws<std::length_error>([&pq]() { pq.Min(); }) && Throws<std::length_error>([&pq]() { pq.Max(); })
+      && Throws<std::length_error>([&pq]() { pq.MinNRemove(); }) && Throws<std::length_error>([&pq]() { pq.RemoveMax(); }));
+    Check(testnum, testerr, "operator[] on an empty queue throws std::out_of_range", Throws<std::out_of_range>([&pq]() { pq[0]; }));
+    pq.Insert(4);
+    Check(testnum, testerr, "A single element is both Min and Max", pq.Min() == 4 && pq.Max() == 4 && pq.Tip() == 4);
+    pq.Insert(9);
+    pq.Insert(1);
+    Check(testnum, testerr, "Min, Max and Tip", pq.Min() == 1 && pq.Max() == 9 && pq.Tip() == 9 && pq.IsHeap());
+    Check(testnum, testerr, "PQMinMax matches a sorted copy after random changes", MinMaxMatchesSorted(2000));
+
+    lasd::PQMinMax<long> built(RandomKeys(5000));
+    Check(testnum, testerr, "Built queue is a min-max heap", built.IsHeap() && built.Size() == 5000);
+    lasd::PQMinMax<long> copy(built);
+    Check(testnum, testerr, "Copy constructor", copy == built);
+    copy.RemoveMin();
+    Check(testnum, testerr, "The copy is independent", copy != built && built.Size() == 5000);
+    lasd::PQMinMax<long> moved(std::move(copy));
+    Check(testnum, testerr, "Move constructor", moved.Size() == 4999 && moved.IsHeap() && copy.Empty());
+    moved.Clear();
+    Check(testnum, testerr, "Clear", moved.Empty() && Throws<std::length_error>([&moved]() { moved.Min(); }));
+  }
+
+  /* ************************************************************************ */
+
+  // Monotone trace checked against the order of removal: every key inserted
+  // is at least the last one popped, some are inserted right after peeking
+  // at a larger tip, and a few queued ones are changed.
+  bool RadixPopsInOrder(ulong n) {
+    std::mt19937 gen(MYTEST_SEED);
+    std::uniform_int_distribution<ulong> delay(0, 1UL << 20);
+    lasd::PQRadix<ulong> pq;
+    lasd::Vector<ulong> popped(n);
+    ulong now = 0, got = 0, inserted = 0;
+    bool same = true;
+    while (got < n) {
+      if (inserted < n && (pq.Empty() || gen() % 3 != 0)) {
+        if (!pq.Empty() && gen() % 4 == 0)
+          same = same && pq.Tip() >= now;
+        ulong key = now + ((gen() % 16 == 0) ? 0 : delay(gen));
+        if (!pq.Empty() && gen() % 8 == 0)
+          pq.Change(gen() % pq.Size(), key);
+        else {
+          pq.Insert(key);
+          ++inserted;
+        }
+      }
+      else {
+        ulong tip = pq.Tip();
+        now = pq.TipNRemove();
+        same = same && tip == now;
+        popped[got++] = now;
+      }
+    }
+    return same && IsSorted(popped) && pq.Empty() && pq.LastKey() == now;
+  }
+
+  void testPQRadix(uint & testnum, uint & testerr) {
+    lasd::PQRadix<ulong> pq;
+    Check(testnum, testerr, "Tip on an empty queue throws std::length_error",
+      Throws<std::length_error>([&pq]() { pq.Tip(); }) && Throws<std::length_error>([&pq]() { pq.TipNRemove(); }));
+    Check(testnum, testerr, "PQRadix pops a monotone trace in order", RadixPopsInOrder(20000));
+
+    lasd::PQRadix<ulong> fresh;
+    fresh.Insert(5);
+    fresh.Insert(10);
+    bool cached = fresh.Tip() == 5;
+    fresh.Insert(0);
+    fresh.RemoveTip();
+    Check(testnum, testerr, "A key equal to the last one removed, inserted after a peek",
+      cached && fresh.Tip() == 5 && fresh.TipNRemove() == 5 && fresh.TipNRemove() == 10 && fresh.Empty() && fresh.LastKey() == 10);
+    Check(testnum, testerr, "Insert below the last key throws std::invalid_argument",
+      Throws<std::invalid_argument>([&fresh]() { fresh.Insert(9UL); }) && fresh.Empty());
+    fresh.Insert(20);
+    Check(testnum, testerr, "Change below the last key throws std::invalid_argument",
+      Throws<std::invalid_argument>([&fresh]() { fresh.Change(0, 9UL); }) && fresh.Tip() == 20);
+    Check(testnum, testerr, "operator[] out of range throws std::out_of_range", Throws<std::out_of_range>([&fresh]() { fresh[1]; }));
+
+    for (ulong key = 30; key < 100; key += 3)
+      fresh.Insert(key);
+    lasd::PQRadix<ulong> copy(fresh);
+    Check(testnum, testerr, "Copy constructor", copy == fresh);
+    copy.RemoveTip();
+    Check(testnum, testerr, "The copy is independent", copy != fresh && fresh.Tip() == 20);
+    lasd::PQRadix<ulong> moved(std::move(copy));
+    Check(testnum, testerr, "Move constructor", moved.Tip() == 30 && moved.LastKey() == 20 && copy.Empty());
+  }
+
+  /* ************************************************************************ */
+
+  // Each thread inserts its own range of keys and then removes as many
+  // elements as it inserted; nothing may be lost or duplicated.
+  bool MultiConservesElements(ulong threads, ulong each) {
+    lasd::PQMulti<long> pq(threads);
+    lasd::Vector<long> sums(threads);
+    std::thread * pool = new std::thread[threads];
+    for (ulong t = 0; t < threads; ++t)
+      pool[t] = std::thread([&pq, &sums, t, each]() {
+        for (ulong i = 0; i < each; ++i)
+          pq.Insert(static_cast<long>(t * each + i));
+        long sum = 0;
+        for (ulong i = 0; i < each; ++i)
+          sum += pq.TipNRemove();
+        sums[t] = sum;
+      });
+    for (ulong t = 0; t < threads; ++t)
+      pool[t].join();
+    delete[] pool;
+    long total = 0, expected = 0;
+    for (ulong t = 0; t < threads; ++t)
+      total += sums[t];
+    for (ulong k = 0; k < threads * each; ++k)
+      expected += k;
+    return total == expected && pq.Empty();
+  }
+
+  void testPQMulti(uint & testnum, uint & testerr) {
+    lasd::PQMulti<long> pq(1, 1);
+    Check(testnum, testerr, "At least two shards", pq.Shards() == 2);
+    Check(testnum, testerr, "TipNRemove on an empty queue throws std::length_error", Throws<std::length_error>([&pq]() { pq.TipNRemove(); }));
+    Check(testnum, testerr, "TryTipNRemove on an empty queue gives nothing", !pq.TryTipNRemove().has_value());
+    for (long key = 0; key < 100; ++key)
+      pq.Insert(key);
+    long sum = 0;
+    while (std::optional<long> got = pq.TryTipNRemove())
+      sum += *got;
+    Check(testnum, testerr, "Single-threaded removal drains every element", sum == 4950 && pq.Empty() && pq.Size() == 0);
+    pq.Insert(1);
+    pq.Clear();
+    Check(testnum, testerr, "Clear", pq.Empty() && !pq.TryTipNRemove());
+    Check(testnum, testerr, "Concurrent inserts and removals conserve the elements", MultiConservesElements(8, 5000));
+  }
+
+  /* ************************************************************************ */
+
+  bool TopKMatchesSorted(ulong n, ulong k) {
+    lasd::Vector<long> keys = RandomKeys(n);
+    lasd::PQTopK<long> best(k, keys);
+    lasd::PQTopK<long, 4, std::greater<long>> worst(k);
+    for (ulong i = 0; i < n; ++i)
+      worst.Insert(keys[i]);
+    lasd::SortableVector<long> sorted(keys);
+    sorted.Sort();
+    lasd::Vector<long> top = best.Sorted(), bottom = worst.Sorted();
+    bool same = best.Full() && top.Size() == k && best.Threshold() == sorted[n - k];
+    for (ulong i = 0; same && i < k; ++i)
+      same = (top[i] == sorted[n - 1 - i]) && (bottom[i] == sorted[i]);
+    lasd::PQTopK<long> copy(best);
+    return same && copy == best && !copy.Insert(sorted[n - k]) && copy.Insert(sorted[n - 1] + 1) && copy != best;
+  }
+
+  void testPQTopK(uint & testnum, uint & testerr) {
+    lasd::PQTopK<long> top(3);
+    Check(testnum, testerr, "Threshold on an empty top-K throws std::length_error", Throws<std::length_error>([&top]() { top.Threshold(); }));
+    Check(testnum, testerr, "operator[] on an empty top-K throws std::out_of_range", Throws<std::out_of_range>([&top]() { top[0]; }));
+    bool kept = top.Insert(5) && top.Insert(1) && top.Insert(9) && top.Full();
+    Check(testnum, testerr, "Keeps everything until full", kept && top.Threshold() == 1 && top.Bound() == 3);
+    Check(testnum, testerr, "Rejects an element no better than the threshold", !top.Insert(1) && !top.Insert(0) && top.Threshold() == 1);
+    Check(testnum, testerr, "A better element replaces the threshold", top.Insert(7) && top.Threshold() == 5 && top.Size() == 3);
+    lasd::Vector<long> sorted = top.Sorted();
+    Check(testnum, testerr, "Sorted gives the best first", sorted.Size() == 3 && sorted[0] == 9 && sorted[1] == 7 && sorted[2] == 5);
+    Check(testnum, testerr, "PQTopK keeps the best (and, reversed, the worst) keys", TopKMatchesSorted(20000, 500));
+
+    lasd::PQTopK<long> none(0, RandomKeys(10));
+    Check(testnum, testerr, "K = 0 keeps nothing", none.Empty() && none.Full() && !none.Insert(1));
+    lasd::PQTopK<long> moved(std::move(top));
+    Check(testnum, testerr, "Move constructor", moved.Size() == 3 && moved.Threshold() == 5 && top.Empty());
+    top = moved;
+    top.Clear();
+    Check(testnum, testerr, "Copy assignment and Clear", top.Empty() && moved.Size() == 3 && top.Insert(1));
+  }
+
+  /* ************************************************************************ */
+
+  // A job: a priority out of a few levels and an id, given in submission order.
+  struct Job {
+    long priority = 0;
+    ulong id = 0;
+
+    bool operator==(const Job & other) const { return priority == other.priority && id == other.id; }
+    bool operator!=(const Job & other) const { return !(*this == other); }
+  };
+
+  struct ByPriority {
+    bool operator()(const Job & sx, const Job & dx) const noexcept { return sx.priority < dx.priority; }
+  };
+
+  // Submissions and dispatches interleaved at random over few priority
+  // levels: equal priorities must be dispatched in submission order.
+  template <typename Queue>
+  bool DispatchesInOrder(Queue & pq, ulong ops, ulong levels) {
+    std::mt19937 gen(MYTEST_SEED);
+    std::uniform_int_distribution<long> level(0, levels - 1);
+    lasd::Vector<ulong> lastId(levels);
+    lastId.Map([](ulong & id) { id = 0; });
+    ulong id = 0;
+    long lastPriority = levels;
+    bool fifo = true;
+    for (ulong i = 0; fifo && i < ops; ++i) {
+      if (pq.Empty() || gen() % 2 == 0) {
+        pq.Insert(Job{level(gen), ++id});
+        lastPriority = levels;
+      }
+      else {
+        Job job = pq.TipNRemove();
+        fifo = job.id > lastId[job.priority] && job.priority <= lastPriority;
+        lastId[job.priority] = job.id;
+        lastPriority = job.priority;
+      }
+    }
+    return fifo;
+  }
+
+  void testPQStable(uint & testnum, uint & testerr) {
+    lasd::PQStable<Job, 2, ByPriority> pq;
+    Check(testnum, testerr, "Tip on an empty queue throws std::length_error",
+      Throws<std::length_error>([&pq]() { pq.Tip(); }) && Throws<std::length_error>([&pq]() { pq.RemoveTip(); }));
+    Check(testnum, testerr, "operator[] on an empty queue throws std::out_of_range", Throws<std::out_of_range>([&pq]() { pq[0]; }));
+    for (ulong id = 1; id <= 6; ++id)
+      pq.Insert(Job{1, id});
+    pq.Insert(Job{2, 7});
+    bool fifo = pq.TipNRemove().id == 7;
+    for (ulong id = 1; fifo && id <= 3; ++id)
+      fifo = pq.TipNRemove().id == id;
+    Check(testnum, testerr, "Equal elements leave in arrival order", fifo && pq.Size() == 3);
+
+    const lasd::LinearContainer<Job> & view = pq;
+    ulong at = 0;
+    while (view[at].id != 6)
+      ++at;
+    pq.Change(at, Job{1, 6});
+    Check(testnum, testerr, "Change keeps the arrival number", pq.TipNRemove().id == 4 && pq.TipNRemove().id == 5 && pq.TipNRemove().id == 6);
+
+    lasd::PQStable<Job, 2, ByPriority> mixed;
+    Check(testnum, testerr, "FIFO within every priority on a random trace", DispatchesInOrder(mixed, 20000, 4));
+    lasd::PQStable<Job, 2, ByPriority, std::uint8_t> narrow;
+    Check(testnum, testerr, "8-bit arrival numbers renumbered on overflow keep FIFO order", DispatchesInOrder(narrow, 20000, 4));
+
+    lasd::PQStable<Job, 2, ByPriority> copy(mixed);
+    Check(testnum, testerr, "Copy constructor", copy == mixed);
+    if (!copy.Empty())
+      copy.RemoveTip();
+    copy.Insert(Job{0, 0});
+    Check(testnum, testerr, "The copy is independent", copy != mixed);
+    lasd::PQStable<Job, 2, ByPriority> moved(std::move(copy));
+    moved.Clear();
+    Check(testnum, testerr, "Move constructor and Clear", moved.Empty() && copy.Empty());
+  }
+
+  /* ************************************************************************ */
+
+  // A backlog built up, then worked through with one new element for every
+  // three removed, against a PQHeap holding the same elements.
+  bool ExtMatchesHeap(ulong n, ulong capacity, ulong block, ulong fanIn) {
+    lasd::Vector<long> keys = RandomKeys(n);
+    lasd::PQExt<long> ext(capacity, std::filesystem::temp_directory_path(), block, fanIn);
+    lasd::PQHeap<long> heap;
+    ulong next = 0, peak = 0;
+    for (; next < n - n / 4; ++next) {
+      ext.Insert(keys[next]);
+      heap.Insert(keys[next]);
+      peak = std::max(peak, ext.Resident());
+    }
+    bool same = ext.Runs() > 0 && ext.Runs() <= fanIn + 1;
+    for (ulong i = 0; same && next < n; ++i) {
+      if (i % 4 == 3) {
+        ext.Insert(keys[next]);
+        heap.Insert(keys[next++]);
+      }
+      else
+        same = ext.Tip() == heap.Tip() && ext.TipNRemove() == heap.TipNRemove();
+      peak = std::max(peak, ext.Resident());
+    }
+    while (same && !ext.Empty())
+      same = ext.TipNRemove() == heap.TipNRemove();
+    return same && heap.Empty() && ext.Runs() == 0 && peak <= capacity + fanIn * block;
+  }
+
+  void testPQExt(uint & testnum, uint & testerr) {
+    lasd::PQExt<long> pq(4, std::filesystem::temp_directory_path(), 2, 2);
+    Check(testnum, testerr, "Tip on an empty queue throws std::length_error",
+      Throws<std::length_error>([&pq]() { pq.Tip(); }) && Throws<std::length_error>([&pq]() { pq.RemoveTip(); }));
+    for (long key = 0; key < 20; ++key)
+      pq.Insert((key * 7) % 20);
+    Check(testnum, testerr, "Elements past the capacity go to runs", pq.Size() == 20 && pq.Runs() > 0 && pq.Resident() < 20);
+    bool ordered = true;
+    for (long key = 19; ordered && key >= 10; --key)
+      ordered = pq.TipNRemove() == key;
+    Check(testnum, testerr, "Removal merges runs and memory in order", ordered && pq.Size() == 10);
+    pq.Clear();
+    Check(testnum, testerr, "Clear drops the runs", pq.Empty() && pq.Runs() == 0 && pq.Resident() == 0);
+    Check(testnum, testerr, "PQExt matches PQHeap across spills and merges, with tiny blocks", ExtMatchesHeap(20000, 300, 7, 3));
+
+    lasd::PQExt<long, std::greater<long>> ascending(10, std::filesystem::temp_directory_path(), 3, 2);
+    lasd::Vector<long> keys = RandomKeys(500);
+    for (ulong i = 0; i < keys.Size(); ++i)
+      ascending.Insert(keys[i]);
+    lasd::Vector<long> out(keys.Size());
+    for (ulong i = 0; i < out.Size(); ++i)
+      out[i] = ascending.TipNRemove();
+    Check(testnum, testerr, "A reversed comparator pops in ascending order", IsSorted(out) && ascending.Empty());
+
+    lasd::PQExt<long> nowhere(3, std::filesystem::temp_directory_path() / "lasd-no-such-directory");
+    for (long key = 0; key < 3; ++key)
+      nowhere.Insert(key);
+    bool refused = Throws<std::runtime_error>([&nowhere]() { nowhere.Insert(3L); });
+    Check(testnum, testerr, "A run that cannot be created throws std::runtime_error and loses nothing",
+      refused && nowhere.Size() == 3 && nowhere.TipNRemove() == 2 && nowhere.TipNRemove() == 1 && nowhere.TipNRemove() == 0);
+
+    std::filesystem::path own = std::filesystem::temp_directory_path() / "lasd-pqext-test";
+    std::filesystem::create_directory(own);
+    std::filesystem::path stray = own / "lasd-pqext-XXXXXX";
+    std::FILE* file = std::fopen(stray.c_str(), "wb");
+    std::fputs("stray", file);
+    std::fclose(file);
+    bool hidden = true;
+    {
+      lasd::PQExt<long> spilled(4, own, 2, 2);
+      for (long key = 0; key < 40; ++key)
+        spilled.Insert(key);
+      hidden = spilled.Runs() > 0 && std::distance(std::filesystem::directory_iterator(own), std::filesystem::directory_iterator()) == 1;
+    }
+    Check(testnum, testerr, "Runs are unlinked at once and leave other files alone",
+      hidden && std::filesystem::file_size(stray) == 5);
+    std::filesystem::remove_all(own);
+
+    // Files may hold a spill of 10 but not the merge of two of them
+    lasd::PQExt<long> capped(10, std::filesystem::temp_directory_path(), 4, 2);
+    lasd::Vector<long> some = RandomKeys(31);
+    rlimit previous, small;
+    getrlimit(RLIMIT_FSIZE, &previous);
+    small = previous;
+    small.rlim_cur = 100;
+    void (*handler)(int) = std::signal(SIGXFSZ, SIG_IGN);
+    setrlimit(RLIMIT_FSIZE, &small);
+    bool failed = Throws<std::runtime_error>([&capped, &some]() {
+      for (ulong i = 0; i < some.Size(); ++i)
+        capped.Insert(some[i]);
+    });
+    setrlimit(RLIMIT_FSIZE, &previous);
+    std::signal(SIGXFSZ, handler);
+    bool kept = failed && capped.Size() == 30 && capped.Runs() == 3;
+    capped.Insert(some[30]);
+    std::vector<long> expected(&some[0], &some[0] + some.Size());
+    std::sort(expected.begin(), expected.end(), std::greater<long>());
+    for (ulong i = 0; kept && i < expected.size(); ++i)
+      kept = capped.TipNRemove() == expected[i];
+    Check(testnum, testerr, "A merge that cannot be written throws std::runtime_error and loses nothing", kept && capped.Empty());
+  }
+
+  /* ************************************************************************ */
+
+  // Monotone trace with far-future keys and changes, checked against the
+  // sequence a PQHeap pops.
+  bool WheelMatchesHeap(ulong n) {
+    std::mt19937_64 gen(MYTEST_SEED);
+    lasd::PQWheel<ulong> wheel;
+    lasd::PQHeap<ulong, 2, std::greater<ulong>> heap;
+    ulong inserted = 0;
+    bool same = true;
+    while (same && (inserted < n || !heap.Empty())) {
+      if (inserted < n && (heap.Empty() || gen() % 3 != 0)) {
+        ulong key = wheel.Now() + ((gen() % 4 == 0) ? gen() % (1UL << 40) : gen() % 1000);
+        if (!heap.Empty() && gen() % 8 == 0) {
+          const lasd::LinearContainer<ulong> & view = wheel;
+          ulong at = gen() % wheel.Size(), old = view[at];
+          wheel.Change(at, key);
+          const lasd::LinearContainer<ulong> & hview = heap;
+          ulong i = 0;
+          while (hview[i] != old)
+            ++i;
+          heap.Change(i, key);
+        }
+        else {
+          wheel.Insert(key);
+          heap.Insert(key);
+          ++inserted;
+        }
+      }
+      else
+        same = wheel.Tip() == heap.Tip() && wheel.TipNRemove() == heap.TipNRemove();
+    }
+    return same && wheel.Empty();
+  }
+
+  void testPQWheel(uint & testnum, uint & testerr) {
+    lasd::PQWheel<ulong> pq;
+    Check(testnum, testerr, "Tip on an empty queue throws std::length_error",
+      Throws<std::length_error>([&pq]() { pq.Tip(); }) && Throws<std::length_error>([&pq]() { pq.TipNRemove(); }));
+    Check(testnum, testerr, "operator[] on an empty queue throws std::out_of_range", Throws<std::out_of_range>([&pq]() { pq[0]; }));
+    pq.Insert(100);
+    pq.Insert(1UL << 45);
+    pq.Insert(50);
+    Check(testnum, testerr, "Keys past the span of the wheel overflow", pq.Overflowing() == 1 && pq.Size() == 3 && pq.Tip() == 50);
+    Check(testnum, testerr, "Removal advances the time", pq.TipNRemove() == 50 && pq.Now() == 50 && pq.TipNRemove() == 100);
+    Check(testnum, testerr, "Insert below the current time throws std::invalid_argument",
+      Throws<std::invalid_argument>([&pq]() { pq.Insert(99UL); }) && pq.Size() == 1);
+    Check(testnum, testerr, "Change below the current time throws std::invalid_argument",
+      Throws<std::invalid_argument>([&pq]() { pq.Change(0, 99UL); }) && pq.Tip() == (1UL << 45));
+    Check(testnum, testerr, "An overflowing key comes back in time", pq.TipNRemove() == (1UL << 45) && pq.Empty() && pq.Overflowing() == 0);
+    Check(testnum, testerr, "PQWheel pops a monotone trace as PQHeap does", WheelMatchesHeap(20000));
+
+    for (ulong key = 0; key < 200; ++key)
+      pq.Insert(pq.Now() + key * key * 1000);
+    lasd::PQWheel<ulong> copy(pq);
+    Check(testnum, testerr, "Copy constructor", copy == pq);
+    copy.RemoveTip();
+    Check(testnum, testerr, "The copy is independent", copy != pq && pq.Size() == 200);
+    lasd::PQWheel<ulong> moved(std::move(copy));
+    Check(testnum, testerr, "Move constructor", moved.Size() == 199 && copy.Empty());
+    moved.Clear();
+    Check(testnum, testerr, "Clear", moved.Empty() && moved.Overflowing() == 0);
+  }
+
+  /* ************************************************************************ */
+
+  // Resizes across the inline capacity, copies and moves, mirrored on a
+  // Vector.
+  bool SmallVectorMatchesVector(ulong rounds) {
+    std::mt19937 gen(MYTEST_SEED);
+    lasd::SmallVector<long, 8> small;
+    lasd::Vector<long> vec;
+    bool same = true;
+    for (ulong r = 0; same && r < rounds; ++r) {
+      ulong dim = gen() % 20;
+      small.Resize(dim);
+      vec.Resize(dim);
+      for (ulong i = 0; i < dim; ++i)
+        if (gen() % 2 == 0)
+          small[i] = vec[i] = static_cast<long>(gen());
+      if (r % 3 == 0) {
+        lasd::SmallVector<long, 8> copy(small);
+        small = std::move(copy);
+        same = copy.Empty();
+      }
+      else if (r % 3 == 1) {
+        lasd::SmallVector<long, 8> moved(std::move(small));
+        small = moved;
+        same = moved == small;
+      }
+      const lasd::LinearContainer<long> & sx = small;
+      const lasd::LinearContainer<long> & dx = vec;
+      same = same && sx == dx && small.Inline() == (dim <= 8);
+    }
+    return same;
+  }
+
+  // Random inserts and removals on a SetVec kept in a SmallVector, crossing
+  // its inline room both ways, mirrored on one kept in a Vector.
+  bool SmallSetMatchesSet(ulong ops) {
+    using SmallSet = lasd::SetVec<long, lasd::SmallVector<long, 16>>;
+    std::mt19937 gen(MYTEST_SEED);
+    SmallSet small;
+    lasd::SetVec<long> flat;
+    bool same = true;
+    for (ulong i = 0; same && i < ops; ++i) {
+      long key = gen() % 48;
+      switch (gen() % 8) {
+        case 0: case 1: case 2:
+          same = (small.Insert(key) == flat.Insert(key));
+          break;
+        case 3: case 4: case 5:
+          same = (small.Remove(key) == flat.Remove(key));
+          break;
+        case 6: {
+          SmallSet copy(small), other;
+          other = std::move(copy);
+          small = other;
+          same = copy.Empty() && other == small;
+          break;
+        }
+        default:
+          if (!flat.Empty())
+            same = (small.MinNRemove() == flat.MinNRemove());
+      }
+      const lasd::LinearContainer<long> & sx = small;
+      const lasd::LinearContainer<long> & dx = flat;
+      same = same && sx == dx;
+    }
+    return same && small.Resource() == nullptr;
+  }
+
+  void testSmallVector(uint & testnum, uint & testerr) {
+    lasd::SmallVector<long, 4> vec;
+    Check(testnum, testerr, "Front/Back on an empty vector throw std::length_error",
+      Throws<std::length_error>([&vec]() { vec.Front(); }) && Throws<std::length_error>([&vec]() { vec.Back(); }));
+    Check(testnum, testerr, "operator[] on an empty vector throws std::out_of_range", Throws<std::out_of_range>([&vec]() { vec[0]; }));
+    vec.Resize(4);
+    vec[3] = 3;
+    Check(testnum, testerr, "Up to N elements stay inline", vec.Inline() && vec.Back() == 3);
+    vec.Resize(5);
+    vec[4] = 4;
+    Check(testnum, testerr, "Past N elements spill to the heap", !vec.Inline() && vec[3] == 3 && vec[4] == 4);
+    vec.Resize(2);
+    Check(testnum, testerr, "Shrinking back moves the elements home", vec.Inline() && vec.Size() == 2);
+    vec.Resize(4);
+    Check(testnum, testerr, "Inline elements past the size are reset", vec[2] == 0 && vec[3] == 0);
+    Check(testnum, testerr, "operator[] past the size throws std::out_of_range", Throws<std::out_of_range>([&vec]() { vec[4]; }));
+    vec.Clear();
+    Check(testnum, testerr, "Clear", vec.Empty() && vec.Inline());
+    Check(testnum, testerr, "SmallVector behaves as Vector across its inline capacity, copies and moves", SmallVectorMatchesVector(5000));
+    Check(testnum, testerr, "SetVec on SmallVector storage matches SetVec", SmallSetMatchesSet(5000));
+  }
+
+  void testStaticVector(uint & testnum, uint & testerr) {
+    lasd::StaticVector<long, 4> vec;
+    Check(testnum, testerr, "Capacity", vec.Capacity() == 4 && vec.Empty() && !vec.Full());
+    Check(testnum, testerr, "Front on an empty vector throws std::length_error", Throws<std::length_error>([&vec]() { vec.Front(); }));
+    Check(testnum, testerr, "operator[] on an empty vector throws std::out_of_range", Throws<std::out_of_range>([&vec]() { vec[0]; }));
+    Check(testnum, testerr, "TryResize within N", vec.TryResize(4) && vec.Full());
+    vec[0] = 1;
+    vec[3] = 4;
+    Check(testnum, testerr, "TryResize beyond N fails and leaves the vector as it is", !vec.TryResize(5) && vec.Size() == 4 && vec.Back() == 4);
+    Check(testnum, testerr, "Resize beyond N throws std::length_error", Throws<std::length_error>([&vec]() { vec.Resize(5); }) && vec.Size() == 4);
+    Check(testnum, testerr, "Constructor beyond N throws std::length_error",
+      Throws<std::length_error>([]() { lasd::StaticVector<long, 4> big(5); })
+      && Throws<std::length_error>([]() { lasd::StaticVector<long, 4> big(lasd::Vector<long>(5)); }));
+    vec.Resize(1);
+    vec.Resize(4);
+    Check(testnum, testerr, "Elements past the size are reset", vec[0] == 1 && vec[3] == 0);
+    lasd::StaticVector<long, 4> copy(vec);
+    Check(testnum, testerr, "Copy constructor", copy == vec);
+    copy[1] = 2;
+    Check(testnum, testerr, "The copy is independent", copy != vec && vec[1] == 0);
+    lasd::StaticVector<long, 4> moved(std::move(copy));
+    Check(testnum, testerr, "Move constructor", moved.Size() == 4 && moved[1] == 2);
+    moved.Clear();
+    Check(testnum, testerr, "Clear", moved.Empty() && moved.TryResize(1) && moved[0] == 0);
+  }
+
+  // Random pushes, changes and pops against PQHeap, with the queue filled up
+  // to its capacity now and then.
+  bool StaticMatchesHeap(ulong n) {
+    lasd::Vector<long> keys = RandomKeys(n);
+    lasd::PQStatic<long, 100, 4> pq;
+    lasd::PQHeap<long, 4> heap;
+    bool same = true;
+    for (ulong i = 0; same && i < n; ++i) {
+      if (pq.Full())
+        same = !pq.TryInsert(keys[i]) && pq.Size() == 100;
+      else if (keys[i] % 5 < 3) {
+        same = pq.TryInsert(keys[i]);
+        heap.Insert(keys[i]);
+      }
+      else if (!pq.Empty() && keys[i] % 5 == 3) {
+        const lasd::LinearContainer<long> & view = pq;
+        const lasd::LinearContainer<long> & hview = heap;
+        ulong at = keys[i] % pq.Size(), j = 0;
+        while (hview[j] != view[at])
+          ++j;
+        pq.Change(at, keys[i]);
+        heap.Change(j, keys[i]);
+      }
+      else if (!pq.Empty())
+        same = pq.TipNRemove() == heap.TipNRemove();
+      if (i % 1000 == 0) {
+        lasd::PQStatic<long, 100, 4> copy(pq);
+        same = same && copy == pq;
+      }
+    }
+    return same;
+  }
+
+  void testPQStatic(uint & testnum, uint & testerr) {
+    lasd::PQStatic<long, 3> pq;
+    Check(testnum, testerr, "Tip on an empty queue throws std::length_error",
+      Throws<std::length_error>([&pq]() { pq.Tip(); }) && Throws<std::length_error>([&pq]() { pq.TipNRemove(); }) && pq.TryTip() == nullptr);
+    Check(testnum, testerr, "operator[] on an empty queue throws std::out_of_range", Throws<std::out_of_range>([&pq]() { pq[0]; }));
+    bool filled = pq.TryInsert(2) && pq.TryInsert(9) && pq.TryInsert(4) && pq.Full();
+    Check(testnum, testerr, "TryInsert on a full queue fails and leaves it as it is", filled && !pq.TryInsert(100) && pq.Size() == 3 && pq.Tip() == 9);
+    Check(testnum, testerr, "Insert on a full queue throws std::length_error", Throws<std::length_error>([&pq]() { pq.Insert(100L); }) && pq.Tip() == 9);
+    Check(testnum, testerr, "Constructor beyond N throws std::length_error",
+      Throws<std::length_error>([]() { lasd::PQStatic<long, 3> big(lasd::Vector<long>(4)); }));
+    lasd::PQStatic<long, 3> copy(pq);
+    Check(testnum, testerr, "Copy constructor", copy == pq);
+    copy.RemoveTip();
+    Check(testnum, testerr, "The copy is independent", copy != pq && copy.Tip() == 4 && pq.Tip() == 9);
+    lasd::PQStatic<long, 3> moved(std::move(copy));
+    Check(testnum, testerr, "Move constructor", moved.Size() == 2 && moved.TipNRemove() == 4 && moved.TipNRemove() == 2);
+    pq.Clear();
+    Check(testnum, testerr, "Clear", pq.Empty() && pq.TryInsert(1));
+    Check(testnum, testerr, "PQStatic matches PQHeap and refuses to overflow", StaticMatchesHeap(20000));
+  }
+
+  /* ************************************************************************ */
+
+  constexpr long frozenKeys[] = {7, 3, 9, 3, 1, 7, 12, 5};
+  constexpr lasd::SetFrozen<long, 8> frozenSmall(frozenKeys);
+  static_assert(frozenSmall.Size() == 6 && frozenSmall.Min() == 1 && frozenSmall.Max() == 12);
+  static_assert(frozenSmall.Exists(9) && !frozenSmall.Exists(4) && frozenSmall.Rank(7) == 3);
+  static_assert(frozenSmall.Predecessor(7) == 5 && frozenSmall.Successor(7) == 9 && frozenSmall.TrySuccessor(12) == nullptr);
+
+  constexpr auto HeapOf(std::array<long, 11> keys) {
+    lasd::HeapifyRange<4>(keys.data(), keys.size(), std::less<long>());
+    return keys;
+  }
+
+  constexpr auto frozenHeap = HeapOf({4, 8, 15, 16, 23, 42, 1, 2, 3, 5, 8});
+  static_assert(frozenHeap[0] == 42 && lasd::IsHeapRange<4>(frozenHeap.data(), frozenHeap.size(), std::less<long>()));
+
+  void testSetFrozen(uint & testnum, uint & testerr) {
+    const lasd::SetFrozen<long, 8> & set = frozenSmall;
+    bool sorted = true;
+    for (ulong i = 1; i < set.Size(); ++i)
+      sorted = sorted && set[i - 1] < set[i];
+    Check(testnum, testerr, "Keys are sorted and distinct", sorted && set.Size() == 6);
+    Check(testnum, testerr, "operator[] past the size throws std::out_of_range", Throws<std::out_of_range>([&set]() { set[6]; }));
+    Check(testnum, testerr, "Select past the size throws std::out_of_range", Throws<std::out_of_range>([&set]() { set.Select(6); }) && set.Select(5) == 12);
+    Check(testnum, testerr, "Predecessor of the minimum throws std::length_error",
+      Throws<std::length_error>([&set]() { set.Predecessor(1); }) && set.TryPredecessor(1) == nullptr);
+    Check(testnum, testerr, "Successor of the maximum throws std::length_error", Throws<std::length_error>([&set]() { set.Successor(12); }));
+    Check(testnum, testerr, "Rank of keys present and missing", set.Rank(7) == 3 && set.Rank(8) == 4 && set.Rank(0) == 0 && set.Rank(100) == 6);
+
+    lasd::SetFrozen<long, 4> empty;
+    Check(testnum, testerr, "Min/Max on an empty set throw std::length_error",
+      Throws<std::length_error>([&empty]() { empty.Min(); }) && Throws<std::length_error>([&empty]() { empty.Max(); }) && empty.TryMin() == nullptr);
+
+    lasd::Vector<long> keys = RandomKeys(64);
+    long raw[64];
+    lasd::SetVec<long> ref;
+    for (ulong i = 0; i < 64; ++i) {
+      raw[i] = keys[i % 48] % 100;
+      ref.Insert(raw[i]);
+    }
+    lasd::SetFrozen<long, 64> built(raw);
+    bool same = built.Size() == ref.Size();
+    for (ulong i = 0; same && i < built.Size(); ++i)
+      same = built[i] == ref.Select(i);
+    for (long key = -1; same && key <= 101; ++key)
+      same = built.Exists(key) == ref.Exists(key) && built.Rank(key) == ref.Rank(key);
+    Check(testnum, testerr, "A set built at run time matches SetVec", same);
+    lasd::SetFrozen<long, 64> copy(built);
+    Check(testnum, testerr, "Copy constructor", copy == built && !(copy != built));
+  }
+
+  /* ************************************************************************ */
+
+  void testAlignedResource(uint & testnum, uint & testerr) {
+    lasd::AlignedResource lines, wide(256), huge(lasd::AlignedResource::cacheLine, lasd::AlignedResource::hugePage);
+    Check(testnum, testerr, "Alignment and huge page threshold",
+      lines.Alignment() == lasd::AlignedResource::cacheLine && wide.Alignment() == 256 && huge.HugeThreshold() == lasd::AlignedResource::hugePage);
+    bool aligned = true;
+    for (ulong dim = 1; aligned && dim < 200; dim += 7) {
+      lasd::Vector<float> vec(dim, lines);
+      lasd::Vector<char> bytes(dim, wide);
+      vec.Resize(dim + 3);
+      aligned = reinterpret_cast<std::uintptr_t>(&vec[0]) % lasd::AlignedResource::cacheLine == 0
+        && reinterpret_cast<std::uintptr_t>(&bytes[0]) % 256 == 0 && vec[dim + 2] == 0.0f;
+    }
+    Check(testnum, testerr, "Buffers are aligned as requested, across resizes", aligned);
+    lasd::Vector<float> big(lasd::AlignedResource::hugePage, huge);
+    Check(testnum, testerr, "Huge buffers are aligned to a huge page", reinterpret_cast<std::uintptr_t>(&big[0]) % lasd::AlignedResource::hugePage == 0);
+    lasd::Vector<float> copy(big);
+    Check(testnum, testerr, "A copy goes to the free store", copy.Resource() == nullptr && big.Resource() == &huge && copy.Size() == big.Size());
+    Check(testnum, testerr, "An alignment that is not a power of two throws std::invalid_argument",
+      Throws<std::invalid_argument>([]() { lasd::AlignedResource odd(96); }));
+    Check(testnum, testerr, "An alignment below a cache line throws std::invalid_argument",
+      Throws<std::invalid_argument>([]() { lasd::AlignedResource small(16); }));
+    Check(testnum, testerr, "Resources are equal when they align alike", lines.is_equal(lasd::AlignedResource()) && !lines.is_equal(huge));
+  }
+
+  /* ************************************************************************ */
+
+  // Forwards to an upstream resource, keeping count of what is outstanding.
+  class CountingResource : public std::pmr::memory_resource {
+  public:
+    ulong allocations = 0;
+    ulong outstanding = 0;
+
+  protected:
+    void * do_allocate(std::size_t bytes, std::size_t align) override {
+      allocations++;
+      outstanding += bytes;
+      return std::pmr::new_delete_resource()->allocate(bytes, align);
+    }
+    void do_deallocate(void * ptr, std::size_t bytes, std::size_t align) override {
+      outstanding -= bytes;
+      std::pmr::new_delete_resource()->deallocate(ptr, bytes, align);
+    }
+    bool do_is_equal(const std::pmr::memory_resource & other) const noexcept override { return this == &other; }
+  };
+
+  // The same operations on containers drawing from a resource and on their
+  // free-store twins, including copies and moves between the two kinds.
+  bool ResourceMatchesFreeStore(CountingResource & res, ulong ops) {
+    std::mt19937 gen(MYTEST_SEED);
+    lasd::List<std::string> list(res), freeList;
+    lasd::SetLst<long> setLst(res), freeSetLst;
+    lasd::SetVec<long> setVec(res), freeSetVec;
+    lasd::PQHeap<long, 4> heap(res), freeHeap;
+    lasd::Vector<long> vec(0, res), freeVec;
+    bool same = true;
+    for (ulong i = 0; same && i < ops; ++i) {
+      long key = gen() % 2000;
+      switch (gen() % 4) {
+        case 0:
+          list.InsertAtBack(std::to_string(key));
+          freeList.InsertAtBack(std::to_string(key));
+          break;
+        case 1:
+          same = setLst.Insert(key) == freeSetLst.Insert(key) && setVec.Insert(key) == freeSetVec.Insert(key);
+          heap.Insert(key);
+          freeHeap.Insert(key);
+          break;
+        case 2:
+          same = setLst.Remove(key) == freeSetLst.Remove(key) && setVec.Remove(key) == freeSetVec.Remove(key);
+          if (!list.Empty())
+            same = same && list.FrontNRemove() == freeList.FrontNRemove();
+          break;
+        default:
+          if (!heap.Empty())
+            same = heap.TipNRemove() == freeHeap.TipNRemove();
+          vec.Resize(key % 100);
+          freeVec.Resize(key % 100);
+          for (ulong j = 0; j < vec.Size(); ++j)
+            vec[j] = freeVec[j] = key + j;
+      }
+      if (i % 997 == 0) {
+        lasd::List<std::string> copy(list);
+        lasd::SetLst<long> setCopy(res);
+        setCopy = freeSetLst;
+        lasd::SetVec<long> moved(std::move(setVec));
+        setVec = std::move(moved);
+        same = same && copy == freeList && setCopy == setLst && copy.Resource() == nullptr && setCopy.Resource() == &res && setVec.Resource() == &res;
+      }
+    }
+    const lasd::LinearContainer<long> & view = vec;
+    const lasd::LinearContainer<long> & freeView = freeVec;
+    same = same && list == freeList && setLst == freeSetLst && setVec == freeSetVec && heap == freeHeap && view == freeView;
+    return same && res.allocations > 0 && freeHeap.Resource() == nullptr;
+  }
+
+  void testMemoryResource(uint & testnum, uint & testerr) {
+    CountingResource res;
+    Check(testnum, testerr, "Containers on a memory resource match the free store", ResourceMatchesFreeStore(res, 20000));
+    Check(testnum, testerr, "Every byte goes back to the resource", res.outstanding == 0);
+    {
+      lasd::Vector<long> vec(10, res);
+      lasd::Vector<long> moved(std::move(vec));
+      Check(testnum, testerr, "A moved vector keeps its resource", moved.Resource() == &res && moved.Size() == 10 && res.outstanding > 0);
+    }
+    Check(testnum, testerr, "The moved buffer goes back to the resource", res.outstanding == 0);
+  }
+
+  /* ************************************************************************ */
+
+  struct Record {
+    long id = 0;
+    double value = 0;
+    bool operator==(const Record&) const noexcept = default;
+  };
+
+  const ulong recordTag = 0x5245434f5244; // Tags files of Record
+
+  std::filesystem::path MappedFile(const std::string& name) {
+    return std::filesystem::temp_directory_path() / ("lasd-mapped-test-" + std::to_string(::getpid()) + "-" + name);
+  }
+
+  // Random resizes and writes mirrored on a Vector, which is left holding
+  // what the file should.
+  bool MappedMatchesVector(const std::filesystem::path& file, lasd::Vector<Record>& mirror, ulong ops) {
+    std::mt19937_64 gen(MYTEST_SEED);
+    lasd::MappedVector<Record> vec(file, lasd::MapMode::ReadWrite, recordTag);
+    bool same = true;
+    for (ulong i = 0; same && i < ops; ++i) {
+      if (gen() % 50 == 0) {
+        ulong dim = gen() % 5000;
+        vec.Resize(dim);
+        mirror.Resize(dim);
+      }
+      else if (!mirror.Empty()) {
+        ulong at = gen() % mirror.Size();
+        vec[at] = mirror[at] = Record{static_cast<long>(gen() >> 1), static_cast<double>(i)};
+      }
+      same = vec.Size() == mirror.Size() && vec.Capacity() >= vec.Size();
+    }
+    vec.Resize(mirror.Size() + 3000);
+    mirror.Resize(mirror.Size() + 3000);
+    vec.Sync();
+    const lasd::LinearContainer<Record> & mirrorView = mirror;
+    return same && vec == vec && static_cast<const lasd::LinearContainer<Record>&>(vec) == mirrorView;
+  }
+
+  void testMappedVector(uint & testnum, uint & testerr) {
+    std::filesystem::path file = MappedFile("check.vec"), other = MappedFile("other.vec");
+    lasd::Vector<Record> mirror;
+    const lasd::LinearContainer<Record> & mirrorView = mirror;
+    Check(testnum, testerr, "Random resizes and writes match a Vector", MappedMatchesVector(file, mirror, 20000));
+    {
+      lasd::MappedVector<Record> vec(file, lasd::MapMode::ReadWrite, recordTag);
+      Check(testnum, testerr, "Reopening read-write reads the elements back", static_cast<const lasd::LinearContainer<Record>&>(vec) == mirrorView);
+    }
+    {
+      lasd::MappedVector<Record> vec(file, lasd::MapMode::ReadOnly, recordTag);
+      const lasd::MappedVector<Record> & view = vec;
+      Check(testnum, testerr, "Reopening read-only reads the elements back", static_cast<const lasd::LinearContainer<Record>&>(vec) == mirrorView && view.Back() == mirror.Back());
+      Check(testnum, testerr, "A read-only vector refuses changes with std::logic_error",
+        Throws<std::logic_error>([&vec]() { vec[0].id = 1; }) && Throws<std::logic_error>([&vec]() { vec.Resize(1); })
+        && Throws<std::logic_error>([&vec]() { vec.Map([](Record&) {}); }));
+      Check(testnum, testerr, "A read-only vector is read through a const reference only",
+        Throws<std::logic_error>([&vec]() { Record rec = vec[0]; (void) rec; }) && Throws<std::logic_error>([&vec]() { Record rec = vec.Front(); (void) rec; })
+        && Throws<std::logic_error>([&vec]() { Record rec = vec.Back(); (void) rec; })
+        && view[0] == mirror[0] && view.Front() == mirror.Front() && view.Back() == mirror.Back());
+      vec.Clear();
+      Check(testnum, testerr, "Clear empties a read-only vector", vec.Empty());
+    }
+    {
+      lasd::MappedVector<Record> vec(file, lasd::MapMode::CopyOnWrite, recordTag);
+      vec.Front().id = -1;
+      vec.Resize(vec.Capacity() + 1000);
+      vec.Back().id = -2;
+      Check(testnum, testerr, "A copy-on-write vector changes and grows", vec.Front().id == -1 && vec.Back().id == -2 && vec[1] == mirror[1]);
+    }
+    {
+      lasd::MappedVector<Record> vec(file, lasd::MapMode::ReadOnly, recordTag);
+      Check(testnum, testerr, "Copy-on-write leaves the file intact", static_cast<const lasd::LinearContainer<Record>&>(vec) == mirrorView);
+    }
+    Check(testnum, testerr, "A wrong tag throws std::runtime_error",
+      Throws<std::runtime_error>([&file]() { lasd::MappedVector<Record> vec(file, lasd::MapMode::ReadOnly, recordTag + 1); }));
+    Check(testnum, testerr, "A wrong record type throws std::runtime_error",
+      Throws<std::runtime_error>([&file]() { lasd::MappedVector<long> vec(file, lasd::MapMode::ReadOnly, recordTag); }));
+    std::ofstream(other) << "not a vector at all, but long enough to hold a header of sixty-four bytes";
+    Check(testnum, testerr, "A foreign file throws std::runtime_error",
+      Throws<std::runtime_error>([&other]() { lasd::MappedVector<Record> vec(other, lasd::MapMode::ReadWrite, recordTag); }));
+    Check(testnum, testerr, "A missing file opened read-only throws std::runtime_error",
+      Throws<std::runtime_error>([]() { lasd::MappedVector<Record> vec(MappedFile("missing.vec"), lasd::MapMode::ReadOnly); }));
+    {
+      lasd::MappedVector<Record> vec(file, lasd::MapMode::ReadWrite, recordTag);
+      vec.Clear();
+      vec.Resize(2);
+      vec.Clear();
+    }
+    bool header = std::filesystem::file_size(file) == 64;
+    {
+      lasd::MappedVector<Record> vec(file, lasd::MapMode::ReadOnly, recordTag);
+      Check(testnum, testerr, "Clear cuts the file down to its header", header && vec.Empty());
+    }
+    std::filesystem::remove(file);
+    std::filesystem::remove(other);
+  }
+
+  /* ************************************************************************ */
+
+  void testExtensions(uint & testnum, uint & testerr) {
+    Group(testnum, testerr, "Rank/Select SetVec<long>", testRankSelect<lasd::SetVec<long>>);
+    Group(testnum, testerr, "Rank/Select SetLst<long>", testRankSelect<lasd::SetLst<long>>);
+    Group(testnum, testerr, "Rank/Select SetTVec<long>", testRankSelect<lasd::SetTVec<long>>);
+    Group(testnum, testerr, "Try lookups SetVec<long>", testTryLookups<lasd::SetVec<long>>);
+    Group(testnum, testerr, "Try lookups SetLst<long>", testTryLookups<lasd::SetLst<long>>);
+    Group(testnum, testerr, "Try lookups SetTVec<long>", testTryLookups<lasd::SetTVec<long>>);
+    Group(testnum, testerr, "TryTip PQHeap<long>", testTryTip);
+    Group(testnum, testerr, "SetTVec<long>", testSetTVec);
+    Group(testnum, testerr, "PQHeap<long>", testPQHeap);
+    Group(testnum, testerr, "PQAddr<long>", testPQAddr);
+    Group(testnum, testerr, "PQPairing<long>", testPQPairing);
+    Group(testnum, testerr, "PQMinMax<long>", testPQMinMax);
+    Group(testnum, testerr, "PQRadix<ulong>", testPQRadix);
+    Group(testnum, testerr, "PQMulti<long>", testPQMulti);
+    Group(testnum, testerr, "PQTopK<long>", testPQTopK);
+    Group(testnum, testerr, "PQStable<Job>", testPQStable);
+    Group(testnum, testerr, "PQExt<long>", testPQExt);
+    Group(testnum, testerr, "PQWheel<ulong>", testPQWheel);
+    Group(testnum, testerr, "SmallVector<long>", testSmallVector);
+    Group(testnum, testerr, "StaticVector<long>", testStaticVector);
+    Group(testnum, testerr, "PQStatic<long>", testPQStatic);
+    Group(testnum, testerr, "SetFrozen<long>", testSetFrozen);
+    Group(testnum, testerr, "AlignedResource", testAlignedResource);
+    Group(testnum, testerr, "Memory resource", testMemoryResource);
+    Group(testnum, testerr, "MappedVector<Record>", testMappedVector);
+    std::cout << std::endl << "My Test (Errors/Tests: " << testerr << "/" << testnum << ")" << std::endl;
+  }
+
 } // namespace myT
 
 using namespace myT;
@@ -3868,6 +5232,9 @@ void mytest()
 
   }
 
+  uint testnum = 0, testerr = 0;
+  testExtensions(testnum, testerr);
+
   std::cout << "Random seed: " << BoxRandomTester<DataT>::seed << std::endl;
   std::cin.get();
 }